@@ -4,7 +4,7 @@
 # Created: Mar 2017
 
 from __future__ import print_function
-import sys, os, subprocess, shlex, time
+import sys, os, subprocess, shlex, time, math
 
 # Some Python 3 compatibility shims
 if sys.version_info.major < 3:
@@ -15,9 +15,16 @@ else:
 class ErrorHandlingSystem(object):
     "Base class for an error handling system"
 
+    # If not None, what the compiler must provide, else the system is skipped
+    requirement = None
+
     def __init__(self):
         pass
 
+    def compiler_flags(self):
+        "Extra flags appended to the compiler command line"
+        return []
+
     def preamble(self, idx):
         "Preamble written out before each source file"
         return ''
@@ -30,30 +37,50 @@ class ErrorHandlingSystem(object):
         "Function implementation for final function zero"
         return r'''{ return par ? -1 : 0; }'''
 
-    def generate_sources(self, no):
-        "Generate no source files calling into one another"
+    def function_sweep(self):
+        "Function implementation for final function zero which fails if par is negative"
+        return r'''{ return par < 0 ? -1 : 0; }'''
+
+    def function_call(self, name):
+        "Call of the next function in the chain"
+        return '%s(par + 1)' % name
+
+    def runner_support(self):
+        "Extra code in function.h needed by runner.cpp to test the return value"
+        return ''
+
+    def runner_function(self, name):
+        "Definition of the FUNCTION macro by which runner.cpp calls the chain as FUNCTION(par)"
+        return 'FUNCTION ' + name
+
+    def generate_sources(self, no, exported = lambda n: False, sweep = False, threaded = False):
+        "Generate no source files calling into one another, marking those where exported(n) with default visibility"
+        visibility = lambda n: '__attribute__((visibility("default"))) ' if exported(n) else ''
+        # Threads sharing the one counter would contend upon it, whatever the error handling system
+        counter = 'static thread_local volatile int counter;' if threaded else 'extern volatile int counter;'
         for n in range(0, no):
             with open("source%04d.cpp" % n, 'wt') as oh:
                 oh.write(self.preamble(n))
-                oh.write(r'''extern volatile int counter;
+                oh.write(counter + r'''
 struct RAII { RAII() { ++counter; } ~RAII() { --counter; } };
 ''')
                 if n:
-                    oh.write(self.function_cont("funct%04d" % (n-1)) + ';\n')
-                oh.write(self.function_cont("funct%04d" % n))
+                    oh.write(visibility(n-1) + self.function_cont("funct%04d" % (n-1)) + ';\n')
+                oh.write(visibility(n) + self.function_cont("funct%04d" % n))
                 if n:
                     oh.write(r'''
 {
   RAII raii;
-  return ''' + ("funct%04d" % (n-1)) + r'''(par + 1);
+  return ''' + self.function_call("funct%04d" % (n-1)) + r''';
 }
 ''')
                 else:
-                    oh.write(self.function_final())
+                    oh.write(self.function_sweep() if sweep else self.function_final())
         with open("function.h", 'wt') as oh:
             oh.write(self.preamble(no-1))
-            oh.write(self.function_cont("funct%04d" % (no-1)) + ';\n')
-            oh.write("#define FUNCTION funct%04d\n" % (no-1))
+            oh.write(visibility(no-1) + self.function_cont("funct%04d" % (no-1)) + ';\n')
+            oh.write(self.runner_support())
+            oh.write("#define " + self.runner_function("funct%04d" % (no-1)) + "\n")
             oh.write("#define NESTING %d\n" % (no))
 
 class ExceptionThrow(ErrorHandlingSystem):
@@ -61,6 +88,8 @@ class ExceptionThrow(ErrorHandlingSystem):
         return '#include <exception>\n' if idx == 0 else ''
     def function_final(self):
         return r'''{ throw std::exception(); }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) throw std::exception(); return 0; }'''
 
 class ResultErrorValue(ErrorHandlingSystem):
     def preamble(self, idx):
@@ -69,6 +98,8 @@ class ResultErrorValue(ErrorHandlingSystem):
         return 'extern OUTCOME_V2_NAMESPACE::result<int> %s(int par)' % name
     def function_final(self):
         return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return std::error_code(5, std::generic_category()); return par; }'''
 
 class ResultErrorError(ResultErrorValue):
     def function_final(self):
@@ -79,6 +110,8 @@ class ResultExceptionValue(ResultErrorValue):
         return 'extern OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr> %s(int par)' % name
     def function_final(self):
         return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return std::make_exception_ptr(std::exception()); return par; }'''
         
 class ResultExceptionError(ResultExceptionValue):
     def function_cont(self, name):
@@ -93,11 +126,100 @@ class ResultExperimentalValue(ErrorHandlingSystem):
         return 'extern OUTCOME_V2_NAMESPACE::experimental::status_result<int> %s(int par)' % name
     def function_final(self):
         return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return OUTCOME_V2_NAMESPACE::experimental::errc::io_error; return par; }'''
 
 class ResultExperimentalError(ResultExperimentalValue):
     def function_final(self):
         return r'''{ return OUTCOME_V2_NAMESPACE::experimental::errc::io_error; }'''
 
+class OutcomeErrorValue(ErrorHandlingSystem):
+    def preamble(self, idx):
+        return '#include "../include/outcome/outcome.hpp"\n'
+    def function_cont(self, name):
+        return 'extern OUTCOME_V2_NAMESPACE::outcome<int> %s(int par)' % name
+    def function_final(self):
+        return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return std::error_code(5, std::generic_category()); return par; }'''
+
+class OutcomeErrorError(OutcomeErrorValue):
+    def function_final(self):
+        return r'''{ return std::error_code(5, std::generic_category()); }'''
+
+class CResultValue(ErrorHandlingSystem):
+    def preamble(self, idx):
+        return '#include "../include/outcome/experimental/result.h"\nCXX_DECLARE_RESULT(int, int, int);\n'
+    def function_cont(self, name):
+        return 'extern CXX_RESULT(int) %s(int par)' % name
+    def function_final(self):
+        return r'''{ CXX_RESULT(int) ret = {par, 1U, 0}; return ret; }'''
+    def function_sweep(self):
+        return r'''{ CXX_RESULT(int) ret = {par, 1U, 0}; if(par < 0) { ret.flags = 2U; ret.error = 5; } return ret; }'''
+    def runner_support(self):
+        return 'inline bool operator!(CXX_RESULT(int) r) { return !CXX_RESULT_HAS_VALUE(r); }\n'
+
+class CResultError(CResultValue):
+    def function_final(self):
+        return r'''{ CXX_RESULT(int) ret = {0, 2U, 5}; return ret; }'''
+
+class ExpectedValue(ErrorHandlingSystem):
+    requirement = 'std::expected'
+    def compiler_flags(self):
+        return ['/std:c++latest'] if sys.platform == 'win32' else ['-std=c++2b']
+    def preamble(self, idx):
+        return '#include <expected>\n#include <system_error>\n'
+    def function_cont(self, name):
+        return 'extern std::expected<int, std::error_code> %s(int par)' % name
+    def function_final(self):
+        return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return std::unexpected(std::error_code(5, std::generic_category())); return par; }'''
+
+class ExpectedError(ExpectedValue):
+    def function_final(self):
+        return r'''{ return std::unexpected(std::error_code(5, std::generic_category())); }'''
+
+# std::optional<int> holding the value, with any error written to an out parameter
+class OptionalValue(ErrorHandlingSystem):
+    def preamble(self, idx):
+        return '#include <optional>\n#include <system_error>\n'
+    def function_cont(self, name):
+        return 'extern std::optional<int> %s(int par, std::error_code &ec)' % name
+    def function_final(self):
+        return r'''{ return par; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) { ec = std::error_code(5, std::generic_category()); return std::nullopt; } return par; }'''
+    def function_call(self, name):
+        return '%s(par + 1, ec)' % name
+    def runner_support(self):
+        return 'static thread_local std::error_code runner_ec;\n'
+    def runner_function(self, name):
+        return 'FUNCTION(par) %s(par, runner_ec)' % name
+
+class OptionalError(OptionalValue):
+    def function_final(self):
+        return r'''{ ec = std::error_code(5, std::generic_category()); return std::nullopt; }'''
+
+# A C style int return of zero or an errno, with the value written to an out parameter
+class CIntReturnsValue(ErrorHandlingSystem):
+    def function_cont(self, name):
+        return 'extern int %s(int par, int *out)' % name
+    def function_final(self):
+        return r'''{ *out = par; return 0; }'''
+    def function_sweep(self):
+        return r'''{ if(par < 0) return 5; *out = par; return 0; }'''
+    def function_call(self, name):
+        return '%s(par + 1, out)' % name
+    def runner_support(self):
+        return 'static thread_local int runner_out;\n'
+    def runner_function(self, name):
+        return 'FUNCTION(par) %s(par, &runner_out)' % name
+
+class CIntReturnsError(CIntReturnsValue):
+    def function_final(self):
+        return r'''{ return 5; }'''
+
 matrix = [
     ('integer-returns', ErrorHandlingSystem),
     ('exception-throw', ExceptionThrow),
@@ -107,6 +229,12 @@ matrix = [
     ('result-excpt-error', ResultExceptionError),
     ('result-exper-value', ResultExperimentalValue),
     ('result-exper-error', ResultExperimentalError),
+    ('expected-value', ExpectedValue),
+    ('expected-error', ExpectedError),
+    ('optional-value', OptionalValue),
+    ('optional-error', OptionalError),
+    ('c-int-value', CIntReturnsValue),
+    ('c-int-error', CIntReturnsError),
 ]
 
 if sys.platform == 'win32':
@@ -121,66 +249,220 @@ elif sys.platform == 'darwin':
     ]
 else:
     compilers = [
-        ('gcc92-noexcept', r'g++-9 -std=c++17 -fno-exceptions -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
-        ('gcc92', r'g++-9 -std=c++17 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
-        ('gcc92-lto', r'g++-9 -std=c++17 -O3 -g -flto -o %s -I../.. -I../../quickcpplib/include'),
-        ('clang90', r'clang++-9 -std=c++17 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
-        ('clang90-lto', r'clang++-9 -std=c++17 -O3 -g -flto -o %s -I../.. -I../../quickcpplib/include'),
+        ('gcc92-noexcept', r'g++-9 -std=c++17 -fno-exceptions -O3 -g -pthread -o %s -I../.. -I../../quickcpplib/include'),
+        ('gcc92', r'g++-9 -std=c++17 -O3 -g -pthread -o %s -I../.. -I../../quickcpplib/include'),
+        ('gcc92-lto', r'g++-9 -std=c++17 -O3 -g -flto -pthread -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang90', r'clang++-9 -std=c++17 -O3 -g -pthread -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang90-lto', r'clang++-9 -std=c++17 -O3 -g -flto -pthread -o %s -I../.. -I../../quickcpplib/include'),
     ]
 
-SOURCES=10
-if len(sys.argv)>1:
-    SOURCES = int(sys.argv[1])
-
-with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
-    resultsh.write('"Compiler"')
-    for m in matrix:
-        resultsh.write(',"'+m[0]+'"')
-    resultsh.write('\n')
-    for compiler in compilers:
-        resultsh.write('"'+compiler[0]+'"')
-        for m in matrix:
-            if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
-                resultsh.write(',')
+# Each system once, as the sweep decides per call whether the chain fails
+sweep_matrix = [
+    ('integer-returns', ErrorHandlingSystem),
+    ('exception-throw', ExceptionThrow),
+    ('result-error', ResultErrorValue),
+    ('result-excpt', ResultExceptionValue),
+    ('result-exper', ResultExperimentalValue),
+    ('outcome-error', OutcomeErrorValue),
+    ('expected', ExpectedValue),
+    ('optional', OptionalValue),
+    ('c-int', CIntReturnsValue),
+]
+sweep_rates = [0.0001, 0.001, 0.01, 0.1, 0.5]
+sweep_depths = [4, 16, 64]
+
+# The systems whose propagation might contend between threads, and the error rates to try
+scaling_matrix = [
+    ('exception-throw', ExceptionThrow),
+    ('result-error', ResultErrorValue),
+    ('outcome-error', OutcomeErrorValue),
+    ('result-exper', ResultExperimentalValue),
+]
+scaling_rates = [0, 0.001, 0.01, 0.1]
+
+def build(instance, compiler, exename, sources, sweep = False, threaded = False):
+    "Generate and compile a chain of sources calls long into exename, returning the path to run it by, or None if the compiler lacks the system's requirement"
+    try:
+        print("\nGenerating sources for", exename, "...")
+        instance.generate_sources(sources, sweep = sweep, threaded = threaded)
+        args = shlex.split(compiler[1] % exename) + instance.compiler_flags()
+        args.append("runner.cpp")
+        for n in range(0, sources):
+            args.append("source%04d.cpp" % n)
+        if sys.platform == 'win32':
+            args.append("/link")
+            args.append("/OPT:REF,ICF")
+        #print(' '.join(args))
+        try:
+            print("Compiling", exename, "...")
+            compile_begin = clock()
+            print(subprocess.check_output(args))
+            compile_end = clock()
+            print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
+        except subprocess.CalledProcessError as e:
+            print(e.output)
+            if instance.requirement is None:
+                raise
+            print("Skipping", exename, "as", instance.requirement, "did not compile")
+            return None
+    finally:
+        for n in range(0, sources):
+            if os.path.exists("source%04d.cpp" % n):
+                os.remove("source%04d.cpp" % n)
+            if os.path.exists("source%04d.obj" % n):
+                os.remove("source%04d.obj" % n)
+        os.remove("function.h")
+        #if os.path.exists(exename):
+        #    os.remove(exename)
+        #if os.path.exists(exename+'.exe'):
+        #    os.remove(exename+'.exe')
+        if os.path.exists("runner.obj"):
+            os.remove("runner.obj")
+    if sys.platform != 'win32':
+        exename = './' + exename
+    return exename
+
+def crossover(rates, throws, returns):
+    "The error rate above which throwing exceptions costs more than returning errors, interpolated on a log scale"
+    diffs = [t - r for t, r in zip(throws, returns)]
+    if diffs[0] > 0:
+        return 0
+    for n in range(1, len(rates)):
+        if diffs[n] > 0:
+            a, b = math.log10(rates[n-1]), math.log10(rates[n])
+            return 10 ** (a + (b - a) * -diffs[n-1] / (diffs[n] - diffs[n-1]))
+    return None
+
+def sweep(depths):
+    "Time each system in sweep_matrix at each error rate for each chain depth, and report where exceptions stop paying"
+    results = []
+    with open('results-sweep-'+sys.platform+'.csv', 'wt') as resultsh:
+        resultsh.write('"Compiler","Depth","Error rate"')
+        for m in sweep_matrix:
+            resultsh.write(',"'+m[0]+'"')
+        resultsh.write('\n')
+        for compiler in compilers:
+            if 'noexcept' in compiler[0]:
                 continue
-            instance = m[1]()
-            try:
-                exename = m[0]+'_'+compiler[0]
-                print("\nGenerating sources for", exename, "...")
-                instance.generate_sources(SOURCES)
-                args = shlex.split(compiler[1] % exename)
-                args.append("runner.cpp")
-                for n in range(0, SOURCES):
-                    args.append("source%04d.cpp" % n)
-                if sys.platform == 'win32':
-                    args.append("/link")
-                    args.append("/OPT:REF,ICF")
-                #print(' '.join(args))
-                try:
-                    print("Compiling", exename, "...")
-                    compile_begin = clock()
-                    print(subprocess.check_output(args))
-                    compile_end = clock()
-                    print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
-                except subprocess.CalledProcessError as e:
-                    print(e.output)
-                    raise
-            finally:
-                for n in range(0, SOURCES):
-                    if os.path.exists("source%04d.cpp" % n):
-                        os.remove("source%04d.cpp" % n)
-                    if os.path.exists("source%04d.obj" % n):
-                        os.remove("source%04d.obj" % n)
-                os.remove("function.h")
-                #if os.path.exists(exename):
-                #    os.remove(exename)
-                #if os.path.exists(exename+'.exe'):
-                #    os.remove(exename+'.exe')
-                if os.path.exists("runner.obj"):
-                    os.remove("runner.obj")
-            if sys.platform != 'win32':
-                exename = './' + exename
-            result = subprocess.check_output([exename]).decode('utf-8')
-            resultsh.write(',' + result.rstrip())
+            for depth in depths:
+                times = {}
+                for m in sweep_matrix:
+                    exename = build(m[1](), compiler, '%s_%s_%d' % (m[0], compiler[0], depth), depth, sweep = True)
+                    if exename is None:
+                        continue
+                    output = subprocess.check_output([exename] + ['%g' % rate for rate in sweep_rates]).decode('utf-8')
+                    times[m[0]] = [float(x) for x in output.split()]
+                for n, rate in enumerate(sweep_rates):
+                    resultsh.write('"%s",%d,%g' % (compiler[0], depth, rate))
+                    for m in sweep_matrix:
+                        resultsh.write(',%f' % times[m[0]][n] if m[0] in times else ',')
+                    resultsh.write('\n')
+                resultsh.flush()
+                results.append((compiler[0], depth, times))
+    print("\nError rate above which exception-throw costs more than:")
+    for compiler, depth, times in results:
+        for m in sweep_matrix:
+            if m[0] == 'exception-throw' or m[0] not in times:
+                continue
+            x = crossover(sweep_rates, times['exception-throw'], times[m[0]])
+            if x is None:
+                x = 'none up to %g%%' % (sweep_rates[-1] * 100)
+            elif x == 0:
+                x = 'every error rate'
+            else:
+                x = '%.3g%%' % (x * 100)
+            print("   %s depth %d %s: %s" % (compiler, depth, m[0], x))
+    try:
+        import matplotlib
+        matplotlib.use('Agg')
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print("\nmatplotlib is not available, so not plotting the crossover")
+        return
+    fig, axes = plt.subplots(len(results), 1, figsize=(8, 4 * len(results)), squeeze=False)
+    for ax, (compiler, depth, times) in zip(axes[:, 0], results):
+        for m in filter(lambda m: m[0] in times, sweep_matrix):
+            ax.plot([rate * 100 for rate in sweep_rates], times[m[0]], marker='o', label=m[0])
+        ax.set_xscale('log')
+        ax.set_yscale('log')
+        ax.set_xlabel('Error rate (%)')
+        ax.set_ylabel('CPU ticks per call')
+        ax.set_title('%s, chain depth %d' % (compiler, depth))
+        ax.legend()
+    fig.tight_layout()
+    fig.savefig('results-sweep-'+sys.platform+'.png')
+
+def thread_counts(most):
+    "Powers of two up to most, then most"
+    ret = [1]
+    while ret[-1] * 2 < most:
+        ret.append(ret[-1] * 2)
+    if most > 1:
+        ret.append(most)
+    return ret
+
+def scaling(sources, most):
+    "Time each system in scaling_matrix on 1 to most threads at each error rate, and report throughput and scaling efficiency"
+    with open('results-scaling-'+sys.platform+'.csv', 'wt') as resultsh:
+        resultsh.write('"Compiler","Error rate","Threads"')
+        for m in scaling_matrix:
+            resultsh.write(',"'+m[0]+' Mcalls/sec","'+m[0]+' efficiency"')
+        resultsh.write('\n')
+        for compiler in compilers:
+            if 'noexcept' in compiler[0]:
+                continue
+            throughput = {}
+            for m in scaling_matrix:
+                exename = build(m[1](), compiler, '%s_%s_mt' % (m[0], compiler[0]), sources, sweep = True, threaded = True)
+                for threads in thread_counts(most):
+                    print("Running", exename, "on", threads, "threads ...")
+                    output = subprocess.check_output([exename, '-t', str(threads)] + ['%g' % rate for rate in scaling_rates]).decode('utf-8')
+                    throughput[(m[0], threads)] = [float(x) for x in output.split()]
+            print("\n%s Mcalls/sec (scaling efficiency), chain depth %d:" % (compiler[0], sources))
+            for n, rate in enumerate(scaling_rates):
+                for threads in thread_counts(most):
+                    resultsh.write('"%s",%g,%d' % (compiler[0], rate, threads))
+                    line = '   error rate %g%% threads %3d:' % (rate * 100, threads)
+                    for m in scaling_matrix:
+                        t = throughput[(m[0], threads)][n]
+                        efficiency = t / (threads * throughput[(m[0], 1)][n])
+                        resultsh.write(',%f,%f' % (t, efficiency))
+                        line += '  %s %.2f (%.0f%%)' % (m[0], t, efficiency * 100)
+                    resultsh.write('\n')
+                    print(line)
             resultsh.flush()
+
+if __name__ == '__main__':
+    # benchmark.py [SOURCES]
+    # benchmark.py --sweep [DEPTH ...]
+    # benchmark.py --scaling [SOURCES [THREADS]]
+    if len(sys.argv)>1 and sys.argv[1] == '--sweep':
+        sweep([int(x) for x in sys.argv[2:]] or sweep_depths)
+        sys.exit(0)
+    if len(sys.argv)>1 and sys.argv[1] == '--scaling':
+        scaling(int(sys.argv[2]) if len(sys.argv)>2 else 10, int(sys.argv[3]) if len(sys.argv)>3 else (os.cpu_count() if hasattr(os, 'cpu_count') else 4))
+        sys.exit(0)
+
+    SOURCES=10
+    if len(sys.argv)>1:
+        SOURCES = int(sys.argv[1])
+
+    with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
+        resultsh.write('"Compiler"')
+        for m in matrix:
+            resultsh.write(',"'+m[0]+'"')
         resultsh.write('\n')
+        for compiler in compilers:
+            resultsh.write('"'+compiler[0]+'"')
+            for m in matrix:
+                if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
+                    resultsh.write(',')
+                    continue
+                exename = build(m[1](), compiler, m[0]+'_'+compiler[0], SOURCES)
+                if exename is None:
+                    resultsh.write(',')
+                    continue
+                result = subprocess.check_output([exename]).decode('utf-8')
+                resultsh.write(',' + result.rstrip())
+                resultsh.flush()
+            resultsh.write('\n')
@@ -0,0 +1,115 @@
+#!/usr/bin/python
+# Benchmark Outcome against other stuff when calls cross shared library boundaries
+# (C) 2026 Outcome contributors
+# Created: Oct 2026
+#
+# The same chain of functions as benchmark.py, but with its translation units
+# spread across LIBS shared libraries. In the interleaved layout every call in
+# the chain crosses into another shared library. In the blocked layout each
+# shared library holds a contiguous part of the chain, so only LIBS-1 calls
+# cross, and only the functions called across a boundary are exported, which
+# lets -fvisibility=hidden and LTO act upon the calls within each library.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex
+
+from benchmark import clock, ErrorHandlingSystem, ResultErrorValue, ResultErrorError, OutcomeErrorValue, OutcomeErrorError, ResultExperimentalValue, ResultExperimentalError, CResultValue, CResultError
+
+matrix = [
+    ('integer-returns', ErrorHandlingSystem),
+    ('result-error-value', ResultErrorValue),
+    ('result-error-error', ResultErrorError),
+    ('outcome-error-value', OutcomeErrorValue),
+    ('outcome-error-error', OutcomeErrorError),
+    ('result-exper-value', ResultExperimentalValue),
+    ('result-exper-error', ResultExperimentalError),
+    ('c-result-value', CResultValue),
+    ('c-result-error', CResultError),
+]
+
+if sys.platform == 'win32':
+    print("The shared library benchmark uses ELF and Mach-O visibility, and does not support Windows")
+    sys.exit(1)
+elif sys.platform == 'darwin':
+    compilers = [
+        ('clang', r'clang++ -std=c++17 -O3 -g -fPIC -I../.. -I../../quickcpplib/include'),
+    ]
+    shared_flags = ['-shared', '-undefined', 'dynamic_lookup']
+    link_flags = ['-Wl,-rpath,@loader_path']
+else:
+    compilers = [
+        ('gcc', r'g++ -std=c++17 -O3 -g -fPIC -I../.. -I../../quickcpplib/include'),
+        ('clang', r'clang++ -std=c++17 -O3 -g -fPIC -I../.. -I../../quickcpplib/include'),
+    ]
+    shared_flags = ['-shared']
+    # The libraries refer to each other in a cycle, and the executable refers to only one of them
+    link_flags = ['-Wl,-rpath,$ORIGIN', '-Wl,--no-as-needed']
+
+# Visibility is a property of how the shared libraries are built, so the executable
+# only ever gets the LTO flag
+variants = [
+    ('default', '', ''),
+    ('hidden', '-fvisibility=hidden -fvisibility-inlines-hidden', ''),
+    ('lto', '-flto', '-flto'),
+    ('hidden-lto', '-fvisibility=hidden -fvisibility-inlines-hidden -flto', '-flto'),
+]
+
+layouts = [
+    ('interleaved', lambda n, sources, libs: n % libs),
+    ('blocked', lambda n, sources, libs: n * libs // sources),
+]
+
+SOURCES=10
+LIBS=4
+if len(sys.argv)>1:
+    SOURCES = int(sys.argv[1])
+if len(sys.argv)>2:
+    LIBS = int(sys.argv[2])
+
+with open('results-dso-'+sys.platform+'.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler"')
+    for m in matrix:
+        resultsh.write(',"'+m[0]+'"')
+    resultsh.write('\n')
+    for compiler in compilers:
+        for variant in variants:
+            for layout in layouts:
+                config = compiler[0]+'-'+variant[0]+'-'+layout[0]
+                lib_of = lambda n: layout[1](n, SOURCES, LIBS)
+                # Exported if called by the runner, or by the next function in the chain in another library
+                exported = lambda n: n == SOURCES - 1 or lib_of(n) != lib_of(n + 1)
+                resultsh.write('"'+config+'"')
+                for m in matrix:
+                    instance = m[1]()
+                    exename = m[0]+'_'+config
+                    libnames = ['lib%s_%d.so' % (exename, k) for k in range(0, LIBS)]
+                    try:
+                        print("\nGenerating sources for", exename, "...")
+                        instance.generate_sources(SOURCES, exported)
+                        print("Compiling", exename, "...")
+                        compile_begin = clock()
+                        for k in range(0, LIBS):
+                            args = shlex.split(compiler[1]) + shlex.split(variant[1]) + shared_flags + ['-o', libnames[k]]
+                            args += ["source%04d.cpp" % n for n in range(0, SOURCES) if lib_of(n) == k]
+                            subprocess.check_output(args)
+                        args = shlex.split(compiler[1]) + shlex.split(variant[2]) + ['-o', exename, 'runner.cpp'] + link_flags + ['./' + x for x in libnames]
+                        subprocess.check_output(args)
+                        compile_end = clock()
+                        print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
+                        result = subprocess.check_output(['./' + exename]).decode('utf-8')
+                    except subprocess.CalledProcessError as e:
+                        print(e.output)
+                        raise
+                    finally:
+                        for n in range(0, SOURCES):
+                            if os.path.exists("source%04d.cpp" % n):
+                                os.remove("source%04d.cpp" % n)
+                        os.remove("function.h")
+                        for x in libnames:
+                            if os.path.exists(x):
+                                os.remove(x)
+                        if os.path.exists(exename):
+                            os.remove(exename)
+                    resultsh.write(',' + result.rstrip())
+                    resultsh.flush()
+                resultsh.write('\n')
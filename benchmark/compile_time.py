@@ -0,0 +1,118 @@
+#!/usr/bin/python
+# Benchmark the compile time of many distinct result and outcome instantiations
+# (C) 2026 Outcome contributors
+# Created: Oct 2026
+#
+# Each translation unit declares N distinct value types, and uses each in its
+# own result or outcome in one of a number of shapes. The compiler is asked how
+# long its frontend spent upon the translation unit, and the figure for a
+# translation unit with no instantiations is subtracted before dividing by N.
+#
+# Clang is asked for -ftime-trace, and its "Total Frontend" and "Total
+# InstantiateClass" events are read back. GCC has no equivalent, so the
+# "phase parsing" and "template instantiation" lines of -ftime-report are read
+# instead, along with the garbage collected memory allocated. Unlike the times,
+# the memory allocated does not vary from run to run, which makes it the better
+# figure for comparing one edition of the headers against another.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, json, re
+
+# (name, header, type, use of value type type%(i)d)
+shapes = [
+    ('result-declare', 'result.hpp', 'result',
+     r'static_assert(sizeof(OUTCOME_V2_NAMESPACE::result<type%(i)d>) > 0, "");'),
+    ('result-construct', 'result.hpp', 'result',
+     r'OUTCOME_V2_NAMESPACE::result<type%(i)d> make%(i)d(int x) { if(x > 0) return type%(i)d{x}; return std::errc::invalid_argument; }'),
+    ('result-try', 'result.hpp', 'result',
+     r'OUTCOME_V2_NAMESPACE::result<int> use%(i)d(OUTCOME_V2_NAMESPACE::result<type%(i)d> &&x) { OUTCOME_TRY(v, std::move(x)); return v.v; }'),
+    ('outcome-declare', 'outcome.hpp', 'outcome',
+     r'static_assert(sizeof(OUTCOME_V2_NAMESPACE::outcome<type%(i)d>) > 0, "");'),
+    ('outcome-construct', 'outcome.hpp', 'outcome',
+     r'OUTCOME_V2_NAMESPACE::outcome<type%(i)d> make%(i)d(int x) { if(x > 0) return type%(i)d{x}; if(x < 0) return std::make_exception_ptr(x); return std::errc::invalid_argument; }'),
+    ('outcome-try', 'outcome.hpp', 'outcome',
+     r'OUTCOME_V2_NAMESPACE::outcome<int> use%(i)d(OUTCOME_V2_NAMESPACE::outcome<type%(i)d> &&x) { OUTCOME_TRY(v, std::move(x)); return v.v; }'),
+]
+
+if sys.platform == 'win32':
+    print("The compile time benchmark reads GCC's -ftime-report and clang's -ftime-trace, and does not support MSVC")
+    sys.exit(1)
+else:
+    # name : (kind of report, command)
+    compilers = [
+        ('gcc-cxx17', 'gcc', r'g++ -std=c++17 -I../include/outcome -I../../quickcpplib/include'),
+        ('gcc-cxx20', 'gcc', r'g++ -std=c++20 -I../include/outcome -I../../quickcpplib/include'),
+        ('clang-cxx17', 'clang', r'clang++ -std=c++17 -I../include/outcome -I../../quickcpplib/include'),
+        ('clang-cxx20', 'clang', r'clang++ -std=c++20 -I../include/outcome -I../../quickcpplib/include'),
+    ]
+
+counts = [100, 400]
+
+
+def generate_source(shape, no):
+    "Writes out a translation unit with no distinct instantiations of the shape"
+    with open('compile_time.cpp', 'wt') as oh:
+        oh.write('#include "' + shape[1] + '"\n#include "try.hpp"\n\n')
+        for i in range(0, no):
+            oh.write('struct type%d\n{\n  int v;\n};\n' % i)
+            oh.write(shape[3] % {'i': i} + '\n')
+
+
+def measure(compiler):
+    "Returns (frontend secs, instantiation secs, memory MB or None) for compile_time.cpp"
+    if compiler[1] == 'clang':
+        args = shlex.split(compiler[2]) + ['-c', '-o', 'compile_time.o', '-ftime-trace', 'compile_time.cpp']
+        subprocess.check_output(args)
+        try:
+            with open('compile_time.json', 'rt') as ih:
+                trace = json.load(ih)
+        finally:
+            os.remove('compile_time.o')
+            os.remove('compile_time.json')
+        totals = {}
+        for event in trace['traceEvents']:
+            if event.get('name', '').startswith('Total '):
+                totals[event['name']] = event['dur'] / 1000000.0
+        return (totals.get('Total Frontend', 0.0), totals.get('Total InstantiateClass', 0.0), None)
+    args = shlex.split(compiler[2]) + ['-fsyntax-only', '-ftime-report', 'compile_time.cpp']
+    report = subprocess.check_output(args, stderr=subprocess.STDOUT).decode('utf-8')
+    def line(name):
+        # name : usr ( %) sys ( %) wall ( %) GGC ( %)
+        m = re.search(r'^ ' + re.escape(name) + r'\s*:\s*(\S+).*?\s(\d+)([kM])\s*\(', report, re.M)
+        if m is None:
+            return (0.0, 0.0)
+        return (float(m.group(1)), int(m.group(2)) / (1024.0 if m.group(3) == 'k' else 1.0))
+    parsing = line('phase parsing')
+    return (parsing[0], line('template instantiation')[0], parsing[1])
+
+
+if __name__ == '__main__':
+    # compile_time.py [N ...]
+    if len(sys.argv) > 1:
+        counts = [int(x) for x in sys.argv[1:]]
+
+    with open('results-compile-time-' + sys.platform + '.csv', 'wt') as resultsh:
+        resultsh.write('"Compiler","Shape","N","Frontend secs","Instantiation secs","Memory MB","Frontend msecs per instantiation","Memory KB per instantiation"\n')
+        for compiler in compilers:
+            for shape in shapes:
+                try:
+                    generate_source(shape, 0)
+                    empty = measure(compiler)
+                    for no in counts:
+                        print("Compiling", no, shape[0], "instantiations with", compiler[0], "...")
+                        generate_source(shape, no)
+                        result = measure(compiler)
+                        frontend = (result[0] - empty[0]) * 1000.0 / no
+                        memory = (result[2] - empty[2]) * 1024.0 / no if result[2] is not None else None
+                        print("   frontend %.2f secs, %.3f msecs per instantiation" % (result[0], frontend) +
+                              ("" if memory is None else ", %.0f KB per instantiation" % memory))
+                        resultsh.write('"%s","%s",%d,%f,%f,%s,%f,%s\n' % (compiler[0], shape[0], no, result[0], result[1],
+                                                                       '' if result[2] is None else '%f' % result[2], frontend,
+                                                                       '' if memory is None else '%f' % memory))
+                        resultsh.flush()
+                except (OSError, subprocess.CalledProcessError) as e:
+                    print("Skipping", compiler[0], "due to", e)
+                    break
+                finally:
+                    if os.path.exists('compile_time.cpp'):
+                        os.remove('compile_time.cpp')
@@ -0,0 +1,170 @@
+#!/usr/bin/python
+# Benchmark the build time saved by the extern template library of common specialisations
+# (C) 2026 Outcome contributors
+# Created: Oct 2026
+#
+# Builds a project of SOURCES translation units, each of which uses result<void>,
+# result<int>, result<std::string> and outcome<int>, once as usual and once with
+# OUTCOME_EXTERN_TEMPLATES=1 linking in src/extern_templates.cpp, which is what
+# linking against the outcome::extern_templates CMake target does. The time to
+# build the library is included in the latter.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, multiprocessing.pool
+if sys.platform != 'win32':
+    import resource
+
+from benchmark import clock
+
+# Every translation unit uses each of the specialisations in src/extern_templates.cpp
+source = r'''#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+namespace ns%(no)d
+{
+  static outcome::result<int> parse(const std::string &s)
+  {
+    if(s.empty())
+      return std::errc::invalid_argument;
+    return static_cast<int>(s.size());
+  }
+  static outcome::result<std::string> name(int x)
+  {
+    if(x < 0)
+      return std::errc::result_out_of_range;
+    return std::string(x, 'a');
+  }
+  static outcome::result<void> check(int x)
+  {
+    if(x > 100)
+      return std::errc::value_too_large;
+    return outcome::success();
+  }
+  static outcome::outcome<int> run(const std::string &s)
+  {
+    OUTCOME_TRY(n, parse(s));
+    OUTCOME_TRY(check(n));
+    OUTCOME_TRY(str, name(n));
+    outcome::result<int> r = parse(str);
+    outcome::outcome<int> o(r.value()), p = o;
+    if(p != o)
+      return std::make_exception_ptr(std::runtime_error("mismatch"));
+    return p.value() + (r == parse(s) ? 1 : 0);
+  }
+}  // namespace ns%(no)d
+
+int use%(no)d(const std::string &s)
+{
+  auto o = ns%(no)d::run(s);
+  return o.has_value() ? o.value() : -1;
+}
+'''
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc-debug', r'cl /nologo /std:c++17 /Od /MDd /EHsc /c /I..\\..\\quickcpplib\\include', r'cl /nologo /MDd /Fe%s'),
+        ('msvc-release', r'cl /nologo /std:c++17 /O2 /MD /EHsc /c /I..\\..\\quickcpplib\\include', r'cl /nologo /MD /Fe%s'),
+    ]
+    object_suffix = '.obj'
+else:
+    compilers = [
+        ('gcc-debug', r'g++ -std=c++17 -O0 -g -c -I../../quickcpplib/include', r'g++ -o %s'),
+        ('gcc-release', r'g++ -std=c++17 -O2 -c -I../../quickcpplib/include', r'g++ -o %s'),
+        ('clang-debug', r'clang++ -std=c++17 -O0 -g -c -I../../quickcpplib/include', r'clang++ -o %s'),
+        ('clang-release', r'clang++ -std=c++17 -O2 -c -I../../quickcpplib/include', r'clang++ -o %s'),
+    ]
+    object_suffix = '.o'
+
+variants = [
+    ('header-only', [], []),
+    ('extern-templates', ['-DOUTCOME_EXTERN_TEMPLATES=1'], ['../src/extern_templates.cpp']),
+]
+
+
+def generate_sources(no):
+    for n in range(0, no):
+        with open('source%04d.cpp' % n, 'wt') as oh:
+            oh.write(source % {'no': n})
+    with open('main.cpp', 'wt') as oh:
+        oh.write('#include <string>\n\n')
+        for n in range(0, no):
+            oh.write('int use%d(const std::string &);\n' % n)
+        oh.write('\nint main()\n{\n  int ret = 0;\n')
+        for n in range(0, no):
+            oh.write('  ret += use%d("hello");\n' % n)
+        oh.write('  return ret == %d ? 0 : 1;\n}\n' % (6 * no))
+
+
+def cpu_secs():
+    if sys.platform == 'win32':
+        return 0
+    usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+    return usage.ru_utime + usage.ru_stime
+
+
+def build(compiler, variant, sources, jobs):
+    "Returns (wall secs, cpu secs) to compile and link sources"
+    def compile_one(src):
+        args = shlex.split(compiler[1]) + variant[1]
+        if sys.platform == 'win32':
+            args += [src.replace('/', '\\'), '/Fo' + os.path.basename(src) + object_suffix]
+        else:
+            args += [src, '-o', os.path.basename(src) + object_suffix]
+        subprocess.check_output(args)
+    begin, cpu_begin = clock(), cpu_secs()
+    multiprocessing.pool.ThreadPool(jobs).map(compile_one, sources + variant[2])
+    args = shlex.split(compiler[2] % 'project') + [os.path.basename(x) + object_suffix for x in sources + variant[2]]
+    subprocess.check_output(args)
+    end, cpu_end = clock(), cpu_secs()
+    subprocess.check_call([os.path.abspath('project')])
+    return (end - begin, cpu_end - cpu_begin)
+
+
+if __name__ == '__main__':
+    # extern_templates.py [SOURCES [JOBS]]
+    SOURCES = 500
+    JOBS = os.cpu_count() if hasattr(os, 'cpu_count') else 4
+    if len(sys.argv) > 1:
+        SOURCES = int(sys.argv[1])
+    if len(sys.argv) > 2:
+        JOBS = int(sys.argv[2])
+
+    generate_sources(SOURCES)
+    sources = ['source%04d.cpp' % n for n in range(0, SOURCES)] + ['main.cpp']
+    try:
+        with open('results-extern-templates-' + sys.platform + '.csv', 'wt') as resultsh:
+            resultsh.write('"Compiler"')
+            for variant in variants:
+                resultsh.write(',"' + variant[0] + ' wall secs","' + variant[0] + ' cpu secs"')
+            resultsh.write(',"Saving"\n')
+            for compiler in compilers:
+                results = []
+                try:
+                    for variant in variants:
+                        print("Building", SOURCES, "sources with", compiler[0], variant[0], "...")
+                        results.append(build(compiler, variant, sources, JOBS))
+                        print("   took %.2f secs (%.2f cpu secs)" % results[-1])
+                except (OSError, subprocess.CalledProcessError) as e:
+                    print("Skipping", compiler[0], "due to", e)
+                    continue
+                # CPU time is not available on Windows, so wall time is compared there
+                which = 1 if results[0][1] > 0 else 0
+                saving = 1 - results[1][which] / results[0][which]
+                print("   %s saves %.1f%% of build time" % (variants[1][0], saving * 100))
+                resultsh.write('"' + compiler[0] + '"')
+                for result in results:
+                    resultsh.write(',%f,%f' % result)
+                resultsh.write(',%f\n' % saving)
+                resultsh.flush()
+    finally:
+        for x in sources + [v for variant in variants for v in variant[2]]:
+            if x.startswith('source') or x == 'main.cpp':
+                os.remove(x)
+            for obj in [os.path.basename(x) + object_suffix]:
+                if os.path.exists(obj):
+                    os.remove(obj)
+        for x in ['project', 'project.exe']:
+            if os.path.exists(x):
+                os.remove(x)
@@ -0,0 +1,582 @@
+/* Microbenchmarks of individual result and outcome operations
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Usage: microbench [--perf] [samples]
+
+Each operation is run in a loop, whose iteration count is doubled until one sample
+of the loop takes at least a millisecond. That loop is then timed `samples` times,
+default 30. The mean, standard deviation and minimum nanoseconds per operation are
+written as CSV to stdout, in the same format as the results of benchmark.py.
+Progress is written to stderr.
+
+With --perf, the hardware performance counters of timing.h are also read around
+each sample, and the mean count per operation of each available counter is written
+as extra columns.
+
+The same operations are measured for std::expected, when the standard library
+provides it, and for the propagation of std::optional with an error_code out
+parameter and of C style int returns, for comparison.
+*/
+
+#include "../include/outcome/coroutine_support.hpp"
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+
+#include "timing.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#define MICROBENCH_HAVE_EXPECTED 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace microbench
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  // Makes the compiler assume `v` was read and may have been modified, without any memory traffic
+#if defined(__GNUC__) || defined(__clang__)
+  template <class T> inline void escape(T &v) { asm volatile("" : : "g"(&v) : "memory"); }
+  template <class T> inline T opaque(T v)
+  {
+    asm volatile("" : "+r"(v));
+    return v;
+  }
+#else
+  static volatile const void *escape_sink;
+  template <class T> inline void escape(T &v)
+  {
+    escape_sink = &v;
+    _ReadWriteBarrier();
+  }
+  template <class T> inline T opaque(T v)
+  {
+    volatile T x = v;
+    return x;
+  }
+#endif
+
+  struct benchmark
+  {
+    const char *name;
+    std::function<void(uint64_t iterations)> loop;
+  };
+  struct stats
+  {
+    double mean{0}, stddev{0}, min{0};
+    double counters[PERF_COUNTERS]{};
+  };
+
+  QUICKCPPLIB_NOINLINE inline double time_loop(const benchmark &b, uint64_t iterations)
+  {
+    auto begin = std::chrono::steady_clock::now();
+    b.loop(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+  }
+
+  // `pc` is null if performance counters are not being read
+  inline stats measure(const benchmark &b, size_t samples, perf_counters *pc)
+  {
+    uint64_t iterations = 64;
+    while(time_loop(b, iterations) < 1000000.0)
+    {
+      iterations *= 2;
+    }
+    std::vector<double> nsop(samples);
+    stats ret;
+    for(auto &i : nsop)
+    {
+      if(pc != nullptr)
+      {
+        perf_counters_start(pc);
+      }
+      i = time_loop(b, iterations) / static_cast<double>(iterations);
+      ret.mean += i;
+      if(pc != nullptr)
+      {
+        perf_counters_stop(pc);
+        for(int n = 0; n < PERF_COUNTERS; n++)
+        {
+          ret.counters[n] += static_cast<double>(pc->values[n]) / static_cast<double>(iterations);
+        }
+      }
+    }
+    ret.mean /= static_cast<double>(samples);
+    for(auto &i : ret.counters)
+    {
+      i /= static_cast<double>(samples);
+    }
+    ret.min = nsop[0];
+    for(auto i : nsop)
+    {
+      ret.stddev += (i - ret.mean) * (i - ret.mean);
+      ret.min = (i < ret.min) ? i : ret.min;
+    }
+    ret.stddev = (samples > 1) ? std::sqrt(ret.stddev / static_cast<double>(samples - 1)) : 0;
+    return ret;
+  }
+
+  // Not inlined, so TRY is measured propagating a result returned from a real call
+  QUICKCPPLIB_NOINLINE inline outcome::result<int> returns_result(int x)
+  {
+    if(x < 0)
+    {
+      return std::errc::invalid_argument;
+    }
+    return x;
+  }
+  QUICKCPPLIB_NOINLINE inline outcome::result<int> tries_result(int x)
+  {
+    OUTCOME_TRY(v, returns_result(x));
+    return v + 1;
+  }
+
+  // The same propagation with each of the alternatives to Outcome
+#ifdef MICROBENCH_HAVE_EXPECTED
+  QUICKCPPLIB_NOINLINE inline std::expected<int, std::error_code> returns_expected(int x)
+  {
+    if(x < 0)
+    {
+      return std::unexpected(make_error_code(std::errc::invalid_argument));
+    }
+    return x;
+  }
+  QUICKCPPLIB_NOINLINE inline std::expected<int, std::error_code> tries_expected(int x)
+  {
+    auto r = returns_expected(x);
+    if(!r)
+    {
+      return std::unexpected(std::move(r).error());
+    }
+    return *r + 1;
+  }
+#endif
+  QUICKCPPLIB_NOINLINE inline std::optional<int> returns_optional(int x, std::error_code &ec)
+  {
+    if(x < 0)
+    {
+      ec = make_error_code(std::errc::invalid_argument);
+      return std::nullopt;
+    }
+    return x;
+  }
+  QUICKCPPLIB_NOINLINE inline std::optional<int> tries_optional(int x, std::error_code &ec)
+  {
+    auto r = returns_optional(x, ec);
+    if(!r)
+    {
+      return std::nullopt;
+    }
+    return *r + 1;
+  }
+  QUICKCPPLIB_NOINLINE inline int returns_int(int x, int *out)
+  {
+    if(x < 0)
+    {
+      return EINVAL;
+    }
+    *out = x;
+    return 0;
+  }
+  QUICKCPPLIB_NOINLINE inline int tries_int(int x, int *out)
+  {
+    int v;
+    if(int ret = returns_int(x, &v))
+    {
+      return ret;
+    }
+    *out = v + 1;
+    return 0;
+  }
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+  inline outcome::awaitables::eager<outcome::result<int>> eager_result(int x) { co_return x; }
+  inline outcome::awaitables::eager<outcome::result<int>> awaits_result(int x)
+  {
+    OUTCOME_CO_TRY(v, co_await eager_result(x));
+    co_return v + 1;
+  }
+#endif
+
+  template <class T, class F> inline void construct_loop(uint64_t iterations, F &&make)
+  {
+    for(uint64_t n = 0; n < iterations; n++)
+    {
+      T r = make(opaque(n));
+      escape(r);
+    }
+  }
+
+  inline std::vector<benchmark> benchmarks()
+  {
+    using outcome::in_place_type;
+    using result_int = outcome::result<int>;
+    using result_long = outcome::result<long>;
+    using result_string = outcome::result<std::string>;
+    using outcome_int = outcome::outcome<int>;
+    static const std::error_code ec = make_error_code(std::errc::invalid_argument);
+    static const std::string str("a string long enough not to fit into the small string buffer");
+
+    std::vector<benchmark> ret;
+    ret.push_back({"loop overhead", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       int x = static_cast<int>(opaque(n));
+                       escape(x);
+                     }
+                   }});
+
+    // Construction
+    ret.push_back({"construct value result<int>", [](uint64_t iterations) { construct_loop<result_int>(iterations, [](uint64_t n) { return result_int(static_cast<int>(n)); }); }});
+    ret.push_back({"construct error result<int>", [](uint64_t iterations) { construct_loop<result_int>(iterations, [](uint64_t /*unused*/) { return result_int(ec); }); }});
+    ret.push_back({"construct in_place result<string>", [](uint64_t iterations) {
+                     construct_loop<result_string>(iterations, [](uint64_t n) { return result_string(in_place_type<std::string>, static_cast<size_t>(n & 7), 'x'); });
+                   }});
+    ret.push_back({"construct value outcome<int>", [](uint64_t iterations) { construct_loop<outcome_int>(iterations, [](uint64_t n) { return outcome_int(static_cast<int>(n)); }); }});
+    ret.push_back({"construct error outcome<int>", [](uint64_t iterations) { construct_loop<outcome_int>(iterations, [](uint64_t /*unused*/) { return outcome_int(ec); }); }});
+
+    // Copy and move
+    ret.push_back({"copy result<int>", [](uint64_t iterations) {
+                     result_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       result_int b(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"copy result<string>", [](uint64_t iterations) {
+                     result_string a(str);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       result_string b(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"move result<string>", [](uint64_t iterations) {
+                     result_string a(str);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       result_string b(std::move(a));
+                       escape(b);
+                       a = std::move(b);
+                       escape(a);
+                     }
+                   }});
+    ret.push_back({"copy outcome<int>", [](uint64_t iterations) {
+                     outcome_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       outcome_int b(a);
+                       escape(b);
+                     }
+                   }});
+
+    // Observers
+    ret.push_back({"value() result<int>", [](uint64_t iterations) {
+                     result_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       int x = a.value();
+                       escape(x);
+                     }
+                   }});
+    ret.push_back({"assume_value() result<int>", [](uint64_t iterations) {
+                     result_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       int x = a.assume_value();
+                       escape(x);
+                     }
+                   }});
+
+    // Propagation
+    ret.push_back({"TRY value result<int>", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_result(static_cast<int>(opaque(n & 0xffff)));
+                       escape(r);
+                     }
+                   }});
+    ret.push_back({"TRY error result<int>", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_result(-1 - static_cast<int>(opaque(n & 0xffff)));
+                       escape(r);
+                     }
+                   }});
+
+    // Swap, comparison and conversion
+    ret.push_back({"swap result<int>", [](uint64_t iterations) {
+                     result_int a(5), b(ec);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       a.swap(b);
+                       escape(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"swap result<string>", [](uint64_t iterations) {
+                     result_string a(str), b(ec);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       a.swap(b);
+                       escape(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"== result<int>", [](uint64_t iterations) {
+                     result_int a(5), b(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       escape(b);
+                       bool x = (a == b);
+                       escape(x);
+                     }
+                   }});
+    ret.push_back({"convert result<int> to result<long>", [](uint64_t iterations) {
+                     result_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       result_long b(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"convert result<int> to outcome<int>", [](uint64_t iterations) {
+                     result_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       outcome_int b(a);
+                       escape(b);
+                     }
+                   }});
+
+#ifdef MICROBENCH_HAVE_EXPECTED
+    // std::expected
+    using expected_int = std::expected<int, std::error_code>;
+    using expected_long = std::expected<long, std::error_code>;
+    ret.push_back({"construct value expected<int>", [](uint64_t iterations) { construct_loop<expected_int>(iterations, [](uint64_t n) { return expected_int(static_cast<int>(n)); }); }});
+    ret.push_back({"construct error expected<int>", [](uint64_t iterations) { construct_loop<expected_int>(iterations, [](uint64_t /*unused*/) { return expected_int(std::unexpect, ec); }); }});
+    ret.push_back({"copy expected<int>", [](uint64_t iterations) {
+                     expected_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       expected_int b(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"value() expected<int>", [](uint64_t iterations) {
+                     expected_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       int x = a.value();
+                       escape(x);
+                     }
+                   }});
+    ret.push_back({"propagate value expected<int>", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_expected(static_cast<int>(opaque(n & 0xffff)));
+                       escape(r);
+                     }
+                   }});
+    ret.push_back({"propagate error expected<int>", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_expected(-1 - static_cast<int>(opaque(n & 0xffff)));
+                       escape(r);
+                     }
+                   }});
+    ret.push_back({"swap expected<int>", [](uint64_t iterations) {
+                     expected_int a(5), b(std::unexpect, ec);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       a.swap(b);
+                       escape(a);
+                       escape(b);
+                     }
+                   }});
+    ret.push_back({"== expected<int>", [](uint64_t iterations) {
+                     expected_int a(5), b(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       escape(b);
+                       bool x = (a == b);
+                       escape(x);
+                     }
+                   }});
+    ret.push_back({"convert expected<int> to expected<long>", [](uint64_t iterations) {
+                     expected_int a(5);
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       escape(a);
+                       expected_long b(a);
+                       escape(b);
+                     }
+                   }});
+#endif
+
+    // std::optional with an error_code out parameter, and C style int returns
+    ret.push_back({"construct value optional<int>", [](uint64_t iterations) { construct_loop<std::optional<int>>(iterations, [](uint64_t n) { return std::optional<int>(static_cast<int>(n)); }); }});
+    ret.push_back({"propagate value optional<int>", [](uint64_t iterations) {
+                     std::error_code e;
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_optional(static_cast<int>(opaque(n & 0xffff)), e);
+                       escape(r);
+                     }
+                     escape(e);
+                   }});
+    ret.push_back({"propagate error optional<int>", [](uint64_t iterations) {
+                     std::error_code e;
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = tries_optional(-1 - static_cast<int>(opaque(n & 0xffff)), e);
+                       escape(r);
+                     }
+                     escape(e);
+                   }});
+    ret.push_back({"propagate value C int return", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       int v = 0;
+                       int r = tries_int(static_cast<int>(opaque(n & 0xffff)), &v);
+                       escape(r);
+                       escape(v);
+                     }
+                   }});
+    ret.push_back({"propagate error C int return", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       int v = 0;
+                       int r = tries_int(-1 - static_cast<int>(opaque(n & 0xffff)), &v);
+                       escape(r);
+                     }
+                   }});
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+    // Coroutines
+    ret.push_back({"co_await eager<result<int>>", [](uint64_t iterations) {
+                     for(uint64_t n = 0; n < iterations; n++)
+                     {
+                       auto r = awaits_result(static_cast<int>(opaque(n & 0xffff))).await_resume();
+                       escape(r);
+                     }
+                   }});
+#endif
+    return ret;
+  }
+}  // namespace microbench
+
+int main(int argc, char *argv[])
+{
+  using namespace microbench;
+  size_t samples = 30;
+  bool use_perf = false;
+  for(int n = 1; n < argc; n++)
+  {
+    if(0 == strcmp(argv[n], "--perf"))
+    {
+      use_perf = true;
+      continue;
+    }
+    samples = static_cast<size_t>(atoi(argv[n]));
+    if(samples < 2)
+    {
+      fprintf(stderr, "Usage: %s [--perf] [samples >= 2]\n", argv[0]);
+      return 1;
+    }
+  }
+  perf_counters counters;
+  perf_counters *pc = nullptr;
+  if(use_perf)
+  {
+    if(perf_counters_open(&counters) > 0)
+    {
+      pc = &counters;
+    }
+    else
+    {
+      fprintf(stderr, "WARNING: Hardware performance counters are not available, perhaps lower /proc/sys/kernel/perf_event_paranoid. Continuing without them.\n");
+    }
+  }
+  printf("\"Operation\",\"mean ns/op\",\"stddev ns/op\",\"min ns/op\"");
+  for(int n = 0; pc != nullptr && n < PERF_COUNTERS; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      printf(",\"%s/op\"", perf_counter_name(n));
+    }
+  }
+  printf("\n");
+  for(const auto &b : benchmarks())
+  {
+    fprintf(stderr, "Benchmarking %s ...\n", b.name);
+    stats s = measure(b, samples, pc);
+    printf("\"%s\",%f,%f,%f", b.name, s.mean, s.stddev, s.min);
+    for(int n = 0; pc != nullptr && n < PERF_COUNTERS; n++)
+    {
+      if(pc->fds[n] >= 0)
+      {
+        printf(",%f", s.counters[n]);
+      }
+    }
+    printf("\n");
+    fflush(stdout);
+  }
+  if(pc != nullptr)
+  {
+    perf_counters_close(pc);
+  }
+  return 0;
+}
@@ -23,44 +23,220 @@ Distributed under the Boost Software License, Version 1.0.
 */
 
 #include "timing.h"
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "function.h"
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
 #include <exception>
 #endif
+#include <atomic>
+#include <string.h>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 #define ITERATIONS 100000
+// How many times each thread goes through the pattern when measuring scaling
+#define PASSES 4
 
 extern volatile int counter;
 volatile int counter, forcereturn;
 
-int main(void)
+/* For the error rate sweep, the parameter handed to each call is drawn from a pattern
+generated before timing begins, from a fixed seed so every error handling system sees
+the same pattern. A negative parameter stays negative all the way down the chain, and
+asks a final function generated for the sweep to fail. The pattern is random, so the
+branch predictors cannot learn which calls fail.
+*/
+static int pattern[ITERATIONS];
+
+static void make_pattern(double rate)
 {
-#ifdef _WIN32
-  SetThreadAffinityMask(GetCurrentThread(), 2ULL);
-#endif
+  // splitmix64
+  uint64_t state = 0x853c49e6748fea9bULL;
+  for(int n = 0; n < ITERATIONS; n++)
   {
-    usCount start=GetUsCount();
-    while(GetUsCount()-start<1*1000000000000LL);
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    pattern[n] = ((double) (z >> 11) / 9007199254740992.0 < rate) ? INT_MIN / 2 : n;
   }
-  auto start = ticksclock();
+}
+
+template <class F> static int calls(F &&par)
+{
+  int ret = 0;
   for(int n=0; n<ITERATIONS; n++)
   {
 #if !defined(_CPPUNWIND) && !defined(__EXCEPTIONS)
-    forcereturn += !FUNCTION(n);
+    ret += !FUNCTION(par(n));
 #else
     try
     {
-      forcereturn += !FUNCTION(n);
+      ret += !FUNCTION(par(n));
     }
     catch(const std::exception &)
     {
     }
 #endif
   }
+  return ret;
+}
+
+template <class F> static double run(F &&par)
+{
+  auto start = ticksclock();
+  forcereturn += calls(par);
   auto end = ticksclock();
   double ticks=end-start;
   ticks/=ITERATIONS;
-  printf("%f\n", ticks);
+  return ticks;
+}
+
+/* The CPUs this process may run upon, so thread n can be pinned to the nth of them.
+Empty if unknown, in which case threads are left to the scheduler.
+*/
+static std::vector<int> allowed_cpus()
+{
+  std::vector<int> ret;
+#ifdef __linux__
+  cpu_set_t set;
+  if(sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    for(int n = 0; n < CPU_SETSIZE; n++)
+    {
+      if(CPU_ISSET(n, &set))
+      {
+        ret.push_back(n);
+      }
+    }
+  }
+#elif defined(_WIN32)
+  DWORD_PTR process, system;
+  if(GetProcessAffinityMask(GetCurrentProcess(), &process, &system))
+  {
+    for(int n = 0; n < (int) (8 * sizeof(process)); n++)
+    {
+      if(process & ((DWORD_PTR) 1 << n))
+      {
+        ret.push_back(n);
+      }
+    }
+  }
+#endif
+  return ret;
+}
+
+static void pin_this_thread(int cpu)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  sched_setaffinity(0, sizeof(set), &set);
+#elif defined(_WIN32)
+  SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR) 1 << cpu);
+#else
+  (void) cpu;
+#endif
+}
+
+/* Each thread is pinned to its own CPU, waits until all are ready, then makes PASSES
+times ITERATIONS calls through the pattern, starting at its own offset so the threads
+do not fail in lockstep. Returns millions of calls per second across all threads.
+*/
+static double run_threads(unsigned threads)
+{
+  const std::vector<int> cpus = allowed_cpus();
+  std::atomic<unsigned> ready(0);
+  std::atomic<bool> go(false);
+  std::atomic<int> failed(0);
+  std::vector<std::thread> workers;
+  for(unsigned t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      if(!cpus.empty())
+      {
+        pin_this_thread(cpus[t % cpus.size()]);
+      }
+      const int offset = (int) ((uint64_t) ITERATIONS * t / threads);
+      ready.fetch_add(1);
+      while(!go.load(std::memory_order_acquire))
+      {
+      }
+      int ret = 0;
+      for(int pass = 0; pass < PASSES; pass++)
+      {
+        ret += calls([offset](int n) {
+          n += offset;
+          return pattern[(n >= ITERATIONS) ? n - ITERATIONS : n];
+        });
+      }
+      failed.fetch_add(ret);
+    });
+  }
+  while(ready.load() != threads)
+  {
+  }
+  usCount start = GetUsCount();
+  go.store(true, std::memory_order_release);
+  for(auto &i : workers)
+  {
+    i.join();
+  }
+  usCount end = GetUsCount();
+  forcereturn += failed.load();
+  return (double) threads * PASSES * ITERATIONS / ((double) (end - start) / 1000000.0);
+}
+
+/* With no arguments, prints the ticks per call of calling FUNCTION(n). Otherwise each
+argument is an error rate between zero and one, and prints the ticks per call of
+calling FUNCTION with a pattern of that error rate, one line per argument.
+
+With -t THREADS before the error rates, instead prints the millions of calls per
+second made by that many threads calling FUNCTION concurrently.
+*/
+int main(int argc, char *argv[])
+{
+  unsigned threads = 0;
+  if(argc > 2 && strcmp(argv[1], "-t") == 0)
+  {
+    threads = (unsigned) atoi(argv[2]);
+    argc -= 2;
+    argv += 2;
+  }
+  if(threads == 0)
+  {
+#ifdef _WIN32
+    SetThreadAffinityMask(GetCurrentThread(), 2ULL);
+#elif defined(__linux__)
+    pin_this_thread(1);
+#endif
+  }
+  {
+    usCount start=GetUsCount();
+    while(GetUsCount()-start<1*1000000000000LL);
+  }
+  if(argc < 2)
+  {
+    printf("%f\n", run([](int n) { return n; }));
+    return 0;
+  }
+  for(int i = 1; i < argc; i++)
+  {
+    make_pattern(atof(argv[i]));
+    if(threads != 0)
+    {
+      printf("%f\n", run_threads(threads));
+    }
+    else
+    {
+      printf("%f\n", run([](int n) { return pattern[n]; }));
+    }
+  }
   return 0;
 }
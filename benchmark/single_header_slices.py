@@ -0,0 +1,127 @@
+#!/usr/bin/python
+# Measure the preprocessed size and parse time of each single header feature set
+# (C) 2026 Outcome contributors
+# Created: Oct 2026
+#
+# Setting OUTCOME_SINGLE_HEADER_FEATURES in cmake generates a minimal single
+# header from a selection of the features below. Each feature set here adds one
+# feature to the one before, from result only up to everything, and a
+# translation unit including the entry headers of that feature set is
+# preprocessed and parsed. The committed editions in single-header/ are
+# measured alongside for comparison, as are any generated slices given on the
+# command line.
+#
+# The size is that of the preprocessed translation unit, which is what every
+# translation unit including the header pays for. The parse time is the best
+# of several runs of clang's "Total Frontend" from -ftime-trace, or GCC's
+# "phase parsing" from -ftime-report along with the garbage collected memory
+# allocated, which unlike the times does not vary from run to run.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, json, re
+
+# Keep in step with the outcome_SINGLE_HEADER_FEATURE_* variables in CMakeLists.txt
+features = [
+    ('result', 'outcome/result.hpp'),
+    ('try', 'outcome/try.hpp'),
+    ('outcome', 'outcome/outcome.hpp'),
+    ('coroutines', 'outcome/coroutine_support.hpp'),
+    ('iostreams', 'outcome/iostream_support.hpp'),
+    ('experimental', 'outcome/experimental/status_outcome.hpp'),
+]
+
+editions = ['outcome-basic.hpp', 'outcome-experimental.hpp', 'outcome.hpp']
+
+if sys.platform == 'win32':
+    print("The single header slices benchmark reads GCC's -ftime-report and clang's -ftime-trace, and does not support MSVC")
+    sys.exit(1)
+else:
+    # name : (kind of report, command)
+    compilers = [
+        ('gcc-cxx17', 'gcc', r'g++ -std=c++17 -I../include -I../../quickcpplib/include -I../../status-code/include'),
+        ('gcc-cxx20', 'gcc', r'g++ -std=c++20 -I../include -I../../quickcpplib/include -I../../status-code/include'),
+        ('clang-cxx17', 'clang', r'clang++ -std=c++17 -I../include -I../../quickcpplib/include -I../../status-code/include'),
+        ('clang-cxx20', 'clang', r'clang++ -std=c++20 -I../include -I../../quickcpplib/include -I../../status-code/include'),
+    ]
+
+runs = 3
+
+
+def generate_source(headers):
+    with open('single_header_slice.cpp', 'wt') as oh:
+        for header in headers:
+            oh.write('#include "' + header + '"\n')
+
+
+def preprocessed_size(compiler):
+    "Returns (bytes, lines) of single_header_slice.cpp once preprocessed"
+    args = shlex.split(compiler[2]) + ['-E', '-P', 'single_header_slice.cpp']
+    out = subprocess.check_output(args)
+    return (len(out), out.count(b'\n'))
+
+
+def parse_time(compiler):
+    "Returns (parse secs, memory MB or None) for single_header_slice.cpp"
+    if compiler[1] == 'clang':
+        args = shlex.split(compiler[2]) + ['-c', '-o', 'single_header_slice.o', '-ftime-trace', 'single_header_slice.cpp']
+        subprocess.check_output(args)
+        try:
+            with open('single_header_slice.json', 'rt') as ih:
+                trace = json.load(ih)
+        finally:
+            os.remove('single_header_slice.o')
+            os.remove('single_header_slice.json')
+        for event in trace['traceEvents']:
+            if event.get('name', '') == 'Total Frontend':
+                return (event['dur'] / 1000000.0, None)
+        return (0.0, None)
+    args = shlex.split(compiler[2]) + ['-fsyntax-only', '-ftime-report', 'single_header_slice.cpp']
+    report = subprocess.check_output(args, stderr=subprocess.STDOUT).decode('utf-8')
+    # phase parsing : usr ( %) sys ( %) wall ( %) GGC ( %)
+    m = re.search(r'^ phase parsing\s*:\s*(\S+).*?\s(\d+)([kM])\s*\(', report, re.M)
+    if m is None:
+        return (0.0, None)
+    return (float(m.group(1)), int(m.group(2)) / (1024.0 if m.group(3) == 'k' else 1.0))
+
+
+def measure(compiler):
+    "Returns (bytes, lines, best parse secs, memory MB or None)"
+    size = preprocessed_size(compiler)
+    times = [parse_time(compiler) for n in range(0, runs)]
+    return size + (min(x[0] for x in times), times[0][1])
+
+
+if __name__ == '__main__':
+    # single_header_slices.py [generated slice ...]
+    slices = []
+    for n in range(0, len(features)):
+        slices.append(('+'.join(x[0] for x in features[:n + 1]), [x[1] for x in features[:n + 1]]))
+    for edition in editions:
+        slices.append(('single-header/' + edition, ['../single-header/' + edition]))
+    for path in sys.argv[1:]:
+        slices.append((os.path.basename(path), [os.path.abspath(path)]))
+
+    try:
+        with open('results-single-header-slices-' + sys.platform + '.csv', 'wt') as resultsh:
+            resultsh.write('"Compiler","Feature set","Preprocessed bytes","Preprocessed lines","Parse secs","Memory MB"\n')
+            for compiler in compilers:
+                for name, headers in slices:
+                    print("Measuring", name, "with", compiler[0], "...")
+                    generate_source(headers)
+                    try:
+                        result = measure(compiler)
+                    except OSError as e:
+                        print("Skipping", compiler[0], "due to", e)
+                        break
+                    except subprocess.CalledProcessError as e:
+                        # The experimental feature needs status-code, and coroutines a C++ 20 compiler
+                        print("   skipping due to", e)
+                        continue
+                    print("   %d bytes, %d lines, parsed in %.2f secs" % result[:3] +
+                          ("" if result[3] is None else ", %.0f MB" % result[3]))
+                    resultsh.write('"%s","%s",%d,%d,%f,%s\n' % (compiler[0], name, result[0], result[1], result[2],
+                                                              '' if result[3] is None else '%f' % result[3]))
+                    resultsh.flush()
+    finally:
+        if os.path.exists('single_header_slice.cpp'):
+            os.remove('single_header_slice.cpp')
@@ -99,6 +99,121 @@ inline uint64_t ticksclock()
   return rdtscp();
 }
 
+/* Hardware performance counters, read around a measured region. Only Linux has them,
+and only if perf_event_open() is permitted (see /proc/sys/kernel/perf_event_paranoid).
+Otherwise perf_counters_open() returns zero, and the other functions do nothing.
+Counters which this CPU or hypervisor lacks are individually marked unavailable.
+*/
+enum perf_counter_kind
+{
+  PERF_COUNTER_INSTRUCTIONS,
+  PERF_COUNTER_BRANCHES,
+  PERF_COUNTER_BRANCH_MISSES,
+  PERF_COUNTER_L1I_MISSES,
+  PERF_COUNTER_L1D_MISSES,
+  PERF_COUNTERS
+};
+struct perf_counters
+{
+  int fds[PERF_COUNTERS];          // -1 if unavailable
+  uint64_t values[PERF_COUNTERS];  // as of the last perf_counters_stop()
+};
+inline const char *perf_counter_name(int idx)
+{
+  static const char *names[PERF_COUNTERS] = {"instructions", "branches", "branch-misses", "L1I-misses", "L1D-misses"};
+  return names[idx];
+}
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Returns the number of counters available
+inline int perf_counters_open(struct perf_counters *pc)
+{
+  static const uint32_t types[PERF_COUNTERS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE};
+  static const uint64_t configs[PERF_COUNTERS] = {
+  PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES,
+  PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+  PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+  int ret = 0;
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = types[n];
+    attr.config = configs[n];
+    attr.disabled = 1;
+    // User space only, which is all the benchmarks run, and which is permitted at perf_event_paranoid 2
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    pc->fds[n] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    pc->values[n] = 0;
+    if(pc->fds[n] >= 0)
+    {
+      ret++;
+    }
+  }
+  return ret;
+}
+inline void perf_counters_start(struct perf_counters *pc)
+{
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      ioctl(pc->fds[n], PERF_EVENT_IOC_RESET, 0);
+      ioctl(pc->fds[n], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+inline void perf_counters_stop(struct perf_counters *pc)
+{
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      ioctl(pc->fds[n], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    if(pc->fds[n] >= 0 && read(pc->fds[n], &pc->values[n], sizeof(pc->values[n])) != (ssize_t) sizeof(pc->values[n]))
+    {
+      pc->values[n] = 0;
+    }
+  }
+}
+inline void perf_counters_close(struct perf_counters *pc)
+{
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    if(pc->fds[n] >= 0)
+    {
+      close(pc->fds[n]);
+      pc->fds[n] = -1;
+    }
+  }
+}
+#else
+inline int perf_counters_open(struct perf_counters *pc)
+{
+  for(int n = 0; n < PERF_COUNTERS; n++)
+  {
+    pc->fds[n] = -1;
+    pc->values[n] = 0;
+  }
+  return 0;
+}
+inline void perf_counters_start(struct perf_counters *) {}
+inline void perf_counters_stop(struct perf_counters *) {}
+inline void perf_counters_close(struct perf_counters *) {}
+#endif
+
 #if defined(__cplusplus) && 0
 #include <chrono>
 #include <iostream>
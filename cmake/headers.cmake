@@ -7,6 +7,7 @@ set(outcome_HEADERS
   "include/outcome/basic_result.hpp"
   "include/outcome/boost_outcome.hpp"
   "include/outcome/boost_result.hpp"
+  "include/outcome/compact_error_code.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
   "include/outcome/coroutine_support.hpp"
@@ -17,7 +18,12 @@ set(outcome_HEADERS
   "include/outcome/detail/basic_result_final.hpp"
   "include/outcome/detail/basic_result_storage.hpp"
   "include/outcome/detail/basic_result_value_observers.hpp"
+  "include/outcome/detail/exception_classifier.hpp"
+  "include/outcome/detail/extern_templates.hpp"
+  "include/outcome/detail/observed_error_code.hpp"
+  "include/outcome/detail/propagation_tracer.hpp"
   "include/outcome/detail/revision.hpp"
+  "include/outcome/detail/tracepoints.hpp"
   "include/outcome/detail/trait_std_error_code.hpp"
   "include/outcome/detail/trait_std_exception.hpp"
   "include/outcome/detail/value_storage.hpp"
@@ -41,23 +47,31 @@ set(outcome_HEADERS
   "include/outcome/experimental/status-code/include/system_error2.hpp"
   "include/outcome/experimental/status-code/include/win32_code.hpp"
   "include/outcome/experimental/status-code/single-header/system_error2.hpp"
+  "include/outcome/experimental/status_code_domain_registry.hpp"
   "include/outcome/experimental/status_outcome.hpp"
   "include/outcome/experimental/status_result.hpp"
+  "include/outcome/interned_message.hpp"
   "include/outcome/iostream_support.hpp"
+  "include/outcome/local_exception_ptr.hpp"
   "include/outcome/outcome.hpp"
   "include/outcome/policy/all_narrow.hpp"
   "include/outcome/policy/base.hpp"
+  "include/outcome/policy/counted_narrow.hpp"
   "include/outcome/policy/fail_to_compile_observers.hpp"
+  "include/outcome/policy/report_and_continue.hpp"
   "include/outcome/policy/outcome_error_code_throw_as_system_error.hpp"
   "include/outcome/policy/outcome_exception_ptr_rethrow.hpp"
   "include/outcome/policy/result_error_code_throw_as_system_error.hpp"
   "include/outcome/policy/result_exception_ptr_rethrow.hpp"
   "include/outcome/policy/terminate.hpp"
   "include/outcome/policy/throw_bad_result_access.hpp"
+  "include/outcome/propagation_tracer.hpp"
   "include/outcome/result.hpp"
+  "include/outcome/sampled_backtrace.hpp"
   "include/outcome/std_outcome.hpp"
   "include/outcome/std_result.hpp"
   "include/outcome/success_failure.hpp"
+  "include/outcome/telemetry.hpp"
   "include/outcome/trait.hpp"
   "include/outcome/try.hpp"
   "include/outcome/utils.hpp"
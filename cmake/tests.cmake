@@ -3,17 +3,25 @@ set(outcome_TESTS
   "test/expected-pass.cpp"
   "test/single-header-test.cpp"
   "test/tests/comparison.cpp"
+  "test/tests/compact-error-code.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
   "test/tests/core-outcome.cpp"
   "test/tests/core-result.cpp"
+  "test/tests/counted-narrow.cpp"
   "test/tests/coroutine-support.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/error-from-exception.cpp"
+  "test/tests/experimental-c-result-array.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
   "test/tests/experimental-p0709a.cpp"
+  "test/tests/experimental-status-code-domain-registry.cpp"
+  "test/tests/experimental-status-exception-ptr.cpp"
+  "test/tests/extern-templates.cpp"
   "test/tests/fileopen.cpp"
   "test/tests/hooks.cpp"
+  "test/tests/interned-message.cpp"
   "test/tests/issue0007.cpp"
   "test/tests/issue0009.cpp"
   "test/tests/issue0010.cpp"
@@ -31,11 +39,18 @@ set(outcome_TESTS
   "test/tests/issue0182.cpp"
   "test/tests/issue0203.cpp"
   "test/tests/issue0210.cpp"
+  "test/tests/local-exception-ptr.cpp"
   "test/tests/noexcept-propagation.cpp"
   "test/tests/propagate.cpp"
+  "test/tests/propagation-tracer.cpp"
+  "test/tests/report-and-continue.cpp"
+  "test/tests/sampled-backtrace.cpp"
   "test/tests/serialisation.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
+  "test/tests/telemetry.cpp"
+  "test/tests/telemetry-sampled-backtrace.cpp"
+  "test/tests/tracepoints.cpp"
   "test/tests/udts.cpp"
   "test/tests/value-or-error.cpp"
 )
@@ -44,8 +59,10 @@ set(outcome_COMPILE_TESTS
 )
 # DO NOT EDIT, GENERATED BY SCRIPT
 set(outcome_COMPILE_FAIL_TESTS
+  "test/compile-fail/c-result-layout.cpp"
   "test/compile-fail/issue0071-fail.cpp"
   "test/compile-fail/outcome-int-int-1.cpp"
+  "test/compile-fail/report-and-continue-default-value.cpp"
   "test/compile-fail/result-int-int-1.cpp"
   "test/compile-fail/result-int-int-2.cpp"
 )
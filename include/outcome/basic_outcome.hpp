@@ -301,6 +301,13 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
+    // Predicate for the deleted constructor diagnosing use of a disabled implicit constructor
+    template <class T>
+    static constexpr bool enable_implicit_constructors_disabled_constructor =  //
+    constructors_enabled && !implicit_constructors_enabled                   //
+    && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T> ||
+        detail::is_implicitly_constructible<exception_type, T>);
+
     // Predicate for the value converting constructor to be available.
     template <class T>
     static constexpr bool enable_value_converting_constructor =  //
@@ -403,9 +410,7 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED((predicate::constructors_enabled && !predicate::implicit_constructors_enabled  //
-                                   && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T> ||
-                                       detail::is_implicitly_constructible<exception_type, T>) )))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_implicit_constructors_disabled_constructor<T>))
   basic_outcome(T && /*unused*/, implicit_constructors_disabled_tag /*unused*/ = implicit_constructors_disabled_tag()) =
   delete;  // NOLINT Implicit constructors disabled, use explicit in_place_type<T>, success() or failure(). see docs!
 
@@ -421,6 +426,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_construction(this, static_cast<T &&>(t));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -434,6 +440,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_construction(this, static_cast<T &&>(t));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -447,6 +454,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_construction(this, static_cast<ErrorCondEnum &&>(t));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -461,6 +469,7 @@ SIGNATURE NOT RECOGNISED
     using namespace hooks;
     this->_state._status.set_have_exception(true);
     hook_outcome_construction(this, static_cast<T &&>(t));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -475,6 +484,7 @@ SIGNATURE NOT RECOGNISED
     using namespace hooks;
     this->_state._status.set_have_exception(true);
     hook_outcome_construction(this, static_cast<T &&>(a), static_cast<U &&>(b));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -504,6 +514,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -520,6 +531,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_move_construction(this, static_cast<basic_outcome<T, U, V, W> &&>(o));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -536,6 +548,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -552,6 +565,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -568,6 +582,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -584,6 +599,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
 
 
@@ -599,6 +615,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_in_place_construction(this, in_place_type<value_type>, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -612,6 +629,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_in_place_construction(this, in_place_type<value_type>, il, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -625,6 +643,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_in_place_construction(this, in_place_type<error_type>, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -638,6 +657,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_in_place_construction(this, in_place_type<error_type>, il, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -652,6 +672,7 @@ SIGNATURE NOT RECOGNISED
     using namespace hooks;
     this->_state._status.set_have_exception(true);
     hook_outcome_in_place_construction(this, in_place_type<exception_type>, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -666,6 +687,7 @@ SIGNATURE NOT RECOGNISED
     using namespace hooks;
     this->_state._status.set_have_exception(true);
     hook_outcome_in_place_construction(this, in_place_type<exception_type>, il, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -688,6 +710,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -699,6 +722,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -710,6 +734,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_move_construction(this, static_cast<success_type<T> &&>(o));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -724,6 +749,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -738,6 +765,8 @@ SIGNATURE NOT RECOGNISED
     this->_state._status.set_have_exception(true);
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -752,6 +781,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -773,6 +804,8 @@ SIGNATURE NOT RECOGNISED
     }
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -787,6 +820,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -801,6 +836,8 @@ SIGNATURE NOT RECOGNISED
     this->_state._status.set_have_exception(true);
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -815,6 +852,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_outcome_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -836,6 +875,8 @@ SIGNATURE NOT RECOGNISED
     }
     using namespace hooks;
     hook_outcome_move_construction(this, static_cast<failure_type<T, U> &&>(o));
+    OUTCOME_TRACEPOINT(outcome_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -876,6 +917,22 @@ SIGNATURE NOT RECOGNISED
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
+*/
+  constexpr bool identical(const basic_outcome &o) const noexcept(noexcept(std::declval<const base &>().identical(std::declval<const base &>()))  //
+                                                                  && noexcept(std::declval<detail::devoid<exception_type>>() == std::declval<detail::devoid<exception_type>>()))
+  {
+    if(!this->_state._status.have_same(o._state._status, detail::result_contents_mask | static_cast<uint16_t>(detail::status::have_exception)))
+    {
+      return false;
+    }
+    if(this->_state._status.have_exception() && !(this->_ptr == o._ptr))
+    {
+      return false;
+    }
+    return static_cast<const base &>(*this).identical(static_cast<const base &>(o));
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T, class U)
   OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<error_type>() == std::declval<T>()),  //
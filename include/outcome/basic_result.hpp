@@ -278,6 +278,12 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
+    // Predicate for the deleted constructor diagnosing use of a disabled implicit constructor
+    template <class T>
+    static constexpr bool enable_implicit_constructors_disabled_constructor =  //
+    constructors_enabled && !implicit_constructors_enabled                   //
+    && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T>);
+
     // Predicate for the value converting constructor to be available.
     template <class T>
     static constexpr bool enable_value_converting_constructor =  //
@@ -376,8 +382,7 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED((predicate::constructors_enabled && !predicate::implicit_constructors_enabled  //
-                                   && (detail::is_implicitly_constructible<value_type, T> || detail::is_implicitly_constructible<error_type, T>) )))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_implicit_constructors_disabled_constructor<T>))
   basic_result(T && /*unused*/, implicit_constructors_disabled_tag /*unused*/ = implicit_constructors_disabled_tag()) =
   delete;  // NOLINT Implicit constructors disabled, use explicit in_place_type<T>, success() or failure(). see docs!
 
@@ -392,6 +397,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_construction(this, static_cast<T &&>(t));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -404,6 +410,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_construction(this, static_cast<T &&>(t));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -417,6 +424,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_construction(this, static_cast<ErrorCondEnum &&>(t));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -443,6 +451,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -457,6 +466,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -471,6 +481,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -485,6 +496,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -499,6 +511,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -513,6 +526,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -525,6 +539,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_in_place_construction(this, in_place_type<value_type>, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -537,6 +552,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_in_place_construction(this, in_place_type<value_type>, il, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -548,6 +564,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_in_place_construction(this, in_place_type<error_type>, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -560,6 +577,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_in_place_construction(this, in_place_type<error_type>, il, static_cast<Args &&>(args)...);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -586,6 +604,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -597,6 +616,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -608,6 +628,7 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<success_type<T> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -620,6 +641,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -632,6 +655,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<failure_type<T> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -645,6 +670,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -658,6 +685,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<failure_type<T> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -671,6 +700,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_copy_construction(this, o);
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -684,6 +715,8 @@ SIGNATURE NOT RECOGNISED
   {
     using namespace hooks;
     hook_result_move_construction(this, static_cast<failure_type<T> &&>(o));
+    OUTCOME_TRACEPOINT(result_construct, this, this->_state._status.status_value);
+    OUTCOME_PROPAGATION_TRACER_ADOPT(this);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -0,0 +1,240 @@
+/* An eight byte error code with categories held in a global table
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COMPACT_ERROR_CODE_HPP
+#define OUTCOME_COMPACT_ERROR_CODE_HPP
+
+#include "outcome.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+#ifndef OUTCOME_COMPACT_ERROR_CODE_CATEGORIES
+//! The number of distinct error categories which `compact_error_code` can refer to, including the system and generic categories.
+#define OUTCOME_COMPACT_ERROR_CODE_CATEGORIES 256
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  static_assert(OUTCOME_COMPACT_ERROR_CODE_CATEGORIES > 2, "OUTCOME_COMPACT_ERROR_CODE_CATEGORIES must leave room for categories besides system and generic");
+  static_assert(sizeof(int) == sizeof(int32_t), "compact_error_code requires a 32 bit int");
+
+  /* Index zero is the system category, index one the generic category, so that neither
+  the default constructed code nor the errno codes ever touch the table. Slots only
+  ever go from null to a category, and are filled in order, so a reader scanning up to
+  the first null slot has seen every category registered before it began.
+  */
+  inline std::atomic<const std::error_category *> *compact_error_categories() noexcept
+  {
+    static std::atomic<const std::error_category *> v[OUTCOME_COMPACT_ERROR_CODE_CATEGORIES];
+    return v;
+  }
+  inline const std::error_category &compact_error_category(uint32_t idx) noexcept
+  {
+    if(idx == 0)
+    {
+      return std::system_category();
+    }
+    if(idx == 1)
+    {
+      return std::generic_category();
+    }
+    return *compact_error_categories()[idx].load(std::memory_order_acquire);
+  }
+  // Returns OUTCOME_COMPACT_ERROR_CODE_CATEGORIES if the table is full
+  inline uint32_t compact_error_category_index(const std::error_category &cat) noexcept
+  {
+    if(cat == std::system_category())
+    {
+      return 0;
+    }
+    if(cat == std::generic_category())
+    {
+      return 1;
+    }
+    std::atomic<const std::error_category *> *table = compact_error_categories();
+    for(uint32_t n = 2; n < OUTCOME_COMPACT_ERROR_CODE_CATEGORIES; n++)
+    {
+      const std::error_category *i = table[n].load(std::memory_order_acquire);
+      if(i == nullptr && table[n].compare_exchange_strong(i, &cat, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        return n;
+      }
+      if(*i == cat)
+      {
+        return n;
+      }
+    }
+    return OUTCOME_COMPACT_ERROR_CODE_CATEGORIES;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline uint32_t register_error_category(const std::error_category &cat)
+{
+  const uint32_t ret = detail::compact_error_category_index(cat);
+  if(ret == OUTCOME_COMPACT_ERROR_CODE_CATEGORIES)
+  {
+    OUTCOME_THROW_EXCEPTION(std::length_error("compact_error_code category table is full, increase OUTCOME_COMPACT_ERROR_CODE_CATEGORIES"));
+  }
+  return ret;
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  compact_error_code. Potential doc page: NOT FOUND
+*/
+class compact_error_code
+{
+  int32_t _value{0};
+  uint32_t _category{0};
+
+public:
+  //! Default constructor, the same as a default constructed `std::error_code`
+  constexpr compact_error_code() noexcept = default;
+  //! Constructs from a value and category. Registers the category if necessary.
+  compact_error_code(int value, const std::error_category &cat)
+      : _value(value)
+      , _category(register_error_category(cat))
+  {
+  }
+  //! Implicit lossless conversion from `std::error_code`. Registers the category if necessary.
+  compact_error_code(const std::error_code &ec)  // NOLINT
+      : compact_error_code(ec.value(), ec.category())
+  {
+  }
+  //! Implicit construction from an error code enum, as `std::error_code` has
+  OUTCOME_TEMPLATE(class ErrorCodeEnum)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_error_code_enum<ErrorCodeEnum>::value))
+  compact_error_code(ErrorCodeEnum e)  // NOLINT
+      : compact_error_code(make_error_code(e))
+  {
+  }
+
+  //! Implicit lossless conversion into `std::error_code`
+  operator std::error_code() const noexcept { return {_value, category()}; }  // NOLINT
+  //! Lossless conversion into `std::error_code`
+  std::error_code to_error_code() const noexcept { return *this; }
+
+  //! The value of the code
+  constexpr int value() const noexcept { return _value; }
+  //! The category of the code
+  const std::error_category &category() const noexcept { return detail::compact_error_category(_category); }
+  //! The index of the category in the global table
+  constexpr uint32_t category_index() const noexcept { return _category; }
+  //! The message for the code
+  std::string message() const { return category().message(_value); }
+  //! Returns the default error condition for the code
+  std::error_condition default_error_condition() const noexcept { return category().default_error_condition(_value); }
+  //! True if the code is not zero
+  constexpr explicit operator bool() const noexcept { return _value != 0; }
+  //! Resets to the default constructed state
+  void clear() noexcept
+  {
+    _value = 0;
+    _category = 0;
+  }
+
+  //! Codes are equal if their values and categories are equal
+  friend constexpr bool operator==(const compact_error_code &a, const compact_error_code &b) noexcept { return a._value == b._value && a._category == b._category; }
+  friend constexpr bool operator!=(const compact_error_code &a, const compact_error_code &b) noexcept { return !(a == b); }
+  friend bool operator==(const compact_error_code &a, const std::error_code &b) noexcept { return a._value == b.value() && a.category() == b.category(); }
+  friend bool operator!=(const compact_error_code &a, const std::error_code &b) noexcept { return !(a == b); }
+  friend bool operator==(const std::error_code &a, const compact_error_code &b) noexcept { return b == a; }
+  friend bool operator!=(const std::error_code &a, const compact_error_code &b) noexcept { return !(b == a); }
+  //! Codes compare equal to conditions they are equivalent to, as `std::error_code` does
+  friend bool operator==(const compact_error_code &a, const std::error_condition &b) noexcept { return std::error_code(a) == b; }
+  friend bool operator!=(const compact_error_code &a, const std::error_condition &b) noexcept { return std::error_code(a) != b; }
+  friend bool operator==(const std::error_condition &a, const compact_error_code &b) noexcept { return a == std::error_code(b); }
+  friend bool operator!=(const std::error_condition &a, const compact_error_code &b) noexcept { return a != std::error_code(b); }
+  OUTCOME_TEMPLATE(class Enum)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_error_condition_enum<Enum>::value))
+  friend bool operator==(const compact_error_code &a, Enum b) noexcept { return std::error_code(a) == make_error_condition(b); }
+  OUTCOME_TEMPLATE(class Enum)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_error_condition_enum<Enum>::value))
+  friend bool operator!=(const compact_error_code &a, Enum b) noexcept { return std::error_code(a) != make_error_condition(b); }
+};
+static_assert(sizeof(compact_error_code) == 8, "compact_error_code is not eight bytes");
+
+// Keep the errno bit working, without looking up the category
+template <class State> constexpr inline void _set_error_is_errno(State &state, const compact_error_code &error)
+{
+  if(error.category_index() == 1
+#ifndef _WIN32
+     || error.category_index() == 0
+#endif
+  )
+  {
+    state._status.set_have_error_is_errno(true);
+  }
+}
+
+// ADL discovered by `trait::is_error_code_available` and `policy::error_code()`
+inline std::error_code make_error_code(compact_error_code v) noexcept { return v; }
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline void outcome_throw_as_system_error_with_payload(const compact_error_code &error) { OUTCOME_THROW_EXCEPTION(std::system_error(error)); }  // NOLINT
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline std::exception_ptr basic_outcome_failure_exception_from_error(const compact_error_code &ec) { return std::make_exception_ptr(std::system_error(ec)); }
+
+namespace trait
+{
+  namespace detail
+  {
+    // Shortcut this for lower build impact
+    template <> struct _is_error_code_available<compact_error_code>
+    {
+      static constexpr bool value = true;
+      using type = std::error_code;
+    };
+  }  // namespace detail
+
+  // compact_error_code is an error type exactly as std::error_code is
+  template <> struct is_error_type<compact_error_code>
+  {
+    static constexpr bool value = true;
+  };
+  template <class Enum> struct is_error_type_enum<compact_error_code, Enum>
+  {
+    static constexpr bool value = std::is_error_condition_enum<Enum>::value;
+  };
+  // Two 32 bit integers without padding, compared member by member
+  template <> struct is_bytewise_comparable<compact_error_code>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
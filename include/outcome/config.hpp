@@ -88,6 +88,11 @@ SIGNATURE NOT RECOGNISED
 #define OUTCOME_REQUIRES(...) QUICKCPPLIB_REQUIRES(__VA_ARGS__)
 #endif
 
+#ifndef OUTCOME_EXTERN_TEMPLATES
+//! When one, `result<void>`, `result<int>`, `result<std::string>` and `outcome<int>` are declared `extern template`, and must be linked from the `outcome::extern_templates` library.
+#define OUTCOME_EXTERN_TEMPLATES 0
+#endif
+
 #include "quickcpplib/import.h"
 
 
@@ -328,6 +333,20 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+// Lets the opt-in instrumentation skip itself during constant evaluation
+#ifndef OUTCOME_IS_CONSTANT_EVALUATED
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define OUTCOME_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 9
+#define OUTCOME_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#include "detail/propagation_tracer.hpp"
+#include "detail/tracepoints.hpp"
+
 #ifndef BOOST_OUTCOME_AUTO_TEST_CASE
 #define BOOST_OUTCOME_AUTO_TEST_CASE(a, b) BOOST_AUTO_TEST_CASE(a, b)
 #endif
@@ -28,10 +28,41 @@ Distributed under the Boost Software License, Version 1.0.
 #include "basic_result_error_observers.hpp"
 #include "basic_result_value_observers.hpp"
 
+#include <cstring>  // for memcmp
+
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
+  // Payloads of the same bytewise comparable type are compared with memcmp() at runtime
+  template <class T, bool = trait::is_bytewise_comparable<T>::value> struct payload_compare
+  {
+    template <class U> static constexpr bool equal(const T &a, const U &b) noexcept(noexcept(a == b)) { return a == b; }
+  };
+  template <class T> struct payload_compare<T, true>
+  {
+    template <class U> static constexpr bool equal(const T &a, const U &b) noexcept(noexcept(a == b)) { return a == b; }
+    static constexpr bool equal(const T &a, const T &b) noexcept
+    {
+#ifdef OUTCOME_IS_CONSTANT_EVALUATED
+      if(!OUTCOME_IS_CONSTANT_EVALUATED())
+      {
+        return 0 == std::memcmp(&a, &b, sizeof(T));
+      }
+#endif
+      return a == b;
+    }
+  };
+  /* How `identical()` compares payloads. Error types specialise this to compare their
+  value and category identity, without any category equivalence lookup.
+  */
+  template <class T> struct identical_payload
+  {
+    static constexpr bool equal(const T &a, const T &b) noexcept(noexcept(payload_compare<T>::equal(a, b))) { return payload_compare<T>::equal(a, b); }
+  };
+  // Which status bits a result compares
+  static constexpr uint16_t result_contents_mask = static_cast<uint16_t>(status::have_value) | static_cast<uint16_t>(status::have_error);
+
   template <class R, class EC, class NoValuePolicy> using select_basic_result_impl = basic_result_error_observers<basic_result_value_observers<basic_result_storage<R, EC, NoValuePolicy>, R, NoValuePolicy>, EC, NoValuePolicy>;
 
   template <class R, class S, class NoValuePolicy>
@@ -60,16 +91,39 @@ namespace detail
     constexpr bool operator==(const basic_result_final<T, U, V> &o) const noexcept(  //
     noexcept(std::declval<detail::devoid<R>>() == std::declval<detail::devoid<T>>()) && noexcept(std::declval<detail::devoid<S>>() == std::declval<detail::devoid<U>>()))
     {
-      if(this->_state._status.have_value() && o._state._status.have_value())
+      if(!this->_state._status.have_same(o._state._status, detail::result_contents_mask))
+      {
+        return false;
+      }
+      if(this->_state._status.have_value())
       {
-        return this->_state._value == o._state._value;  // NOLINT
+        return detail::payload_compare<detail::devoid<R>>::equal(this->_state._value, o._state._value);  // NOLINT
       }
-      if(this->_state._status.have_error() && o._state._status.have_error())
+      if(this->_state._status.have_error())
       {
-        return this->_error == o._error;
+        return detail::payload_compare<detail::devoid<S>>::equal(this->_error, o._error);
       }
       return false;
     }
+    //! True if both hold the same value, or the same error. Errors are compared by identity of value and category, without consulting the category.
+    constexpr bool identical(const basic_result_final &o) const
+    noexcept(noexcept(detail::identical_payload<detail::devoid<R>>::equal(std::declval<const detail::devoid<R> &>(), std::declval<const detail::devoid<R> &>()))  //
+             && noexcept(detail::identical_payload<detail::devoid<S>>::equal(std::declval<const detail::devoid<S> &>(), std::declval<const detail::devoid<S> &>())))
+    {
+      if(!this->_state._status.have_same(o._state._status, detail::result_contents_mask))
+      {
+        return false;
+      }
+      if(this->_state._status.have_value())
+      {
+        return detail::identical_payload<detail::devoid<R>>::equal(this->_state._value, o._state._value);  // NOLINT
+      }
+      if(this->_state._status.have_error())
+      {
+        return detail::identical_payload<detail::devoid<S>>::equal(this->_error, o._error);
+      }
+      return true;
+    }
     OUTCOME_TEMPLATE(class T)
     OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R>() == std::declval<T>()))
     constexpr bool operator==(const success_type<T> &o) const noexcept(  //
@@ -103,11 +157,15 @@ namespace detail
     constexpr bool operator!=(const basic_result_final<T, U, V> &o) const noexcept(  //
     noexcept(std::declval<detail::devoid<R>>() != std::declval<detail::devoid<T>>()) && noexcept(std::declval<detail::devoid<S>>() != std::declval<detail::devoid<U>>()))
     {
-      if(this->_state._status.have_value() && o._state._status.have_value())
+      if(!this->_state._status.have_same(o._state._status, detail::result_contents_mask))
+      {
+        return true;
+      }
+      if(this->_state._status.have_value())
       {
         return this->_state._value != o._state._value;
       }
-      if(this->_state._status.have_error() && o._state._status.have_error())
+      if(this->_state._status.have_error())
       {
         return this->_error != o._error;
       }
@@ -33,6 +33,17 @@ namespace detail
 {
   template <class Base, class R, class NoValuePolicy> class basic_result_value_observers : public Base
   {
+    // A policy whose wide_value_check() can return without a value defines wide_value() to say what value() returns instead
+    template <class Self, class Policy = NoValuePolicy>
+    static constexpr auto _wide_value(Self &&self, int /*unused*/) -> decltype(Policy::wide_value(static_cast<Self &&>(self)))
+    {
+      return Policy::wide_value(static_cast<Self &&>(self));
+    }
+    template <class Self> static constexpr auto _wide_value(Self &&self, long /*unused*/) noexcept -> decltype((static_cast<Self &&>(self)._state._value))
+    {
+      return static_cast<Self &&>(self)._state._value;  // NOLINT
+    }
+
   public:
     using value_type = R;
     using Base::Base;
@@ -61,22 +72,22 @@ namespace detail
     constexpr value_type &value() &
     {
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return _wide_value(static_cast<basic_result_value_observers &>(*this), 0);
     }
     constexpr const value_type &value() const &
     {
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return _wide_value(static_cast<const basic_result_value_observers &>(*this), 0);
     }
     constexpr value_type &&value() &&
     {
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &&>(*this));
-      return static_cast<value_type &&>(this->_state._value);  // NOLINT
+      return _wide_value(static_cast<basic_result_value_observers &&>(*this), 0);
     }
     constexpr const value_type &&value() const &&
     {
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &&>(*this));
-      return static_cast<const value_type &&>(this->_state._value);  // NOLINT
+      return _wide_value(static_cast<const basic_result_value_observers &&>(*this), 0);
     }
   };
   template <class Base, class NoValuePolicy> class basic_result_value_observers<Base, void, NoValuePolicy> : public Base
@@ -0,0 +1,316 @@
+/* Classifies exception_ptrs into error codes without rethrowing
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_EXCEPTION_CLASSIFIER_HPP
+#define OUTCOME_DETAIL_EXCEPTION_CLASSIFIER_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <typeinfo>
+
+#ifndef OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE
+//! The number of distinct thrown types the classifier remembers. Must be a power of two.
+#define OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE 64
+#endif
+#ifndef OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE
+//! The number of user exception to error code mappings which can be registered.
+#define OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE 32
+#endif
+
+/* libstdc++ exposes both the dynamic type of an exception_ptr and the catch matching
+used by the unwinder, so there the thrown object can be classified without rethrowing it.
+Elsewhere registered mappings are tried by rethrowing, followed by the standard ladder.
+*/
+#ifndef OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER
+#if defined(__cpp_exceptions) && defined(__GLIBCXX__) && (defined(__cpp_rtti) || defined(__GXX_RTTI))
+#define OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER 1
+#else
+#define OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER 0
+#endif
+#endif
+
+#ifdef __cpp_exceptions
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  static_assert((OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE & (OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE - 1)) == 0, "OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE must be a power of two");
+  static_assert(OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE < 32768, "OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE must fit into a cache entry");
+
+  struct exception_mapping
+  {
+#if OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER
+    const std::type_info *type{nullptr};
+    // Converts a thrown object already adjusted to point at `type`
+    std::error_code (*convert)(const void *object, const exception_mapping &self){nullptr};
+#endif
+    // Converts by rethrowing, returns false if the exception is not of `type`
+    bool (*rethrow_match)(const std::exception_ptr &ep, const exception_mapping &self, std::error_code &out){nullptr};
+    std::error_code constant;
+    void (*user)(){nullptr};  // the registered converter, type erased
+  };
+
+  template <class E> inline std::error_code exception_mapping_constant(const void * /*unused*/, const exception_mapping &self) noexcept { return self.constant; }
+  template <class E> inline std::error_code exception_mapping_user(const void *object, const exception_mapping &self) noexcept
+  {
+    return reinterpret_cast<std::error_code (*)(const E &)>(self.user)(*static_cast<const E *>(object));  // NOLINT
+  }
+  template <class E> inline bool exception_mapping_rethrow(const std::exception_ptr &ep, const exception_mapping &self, std::error_code &out) noexcept
+  {
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const E &e)
+    {
+      out = (self.user != nullptr) ? reinterpret_cast<std::error_code (*)(const E &)>(self.user)(e) : self.constant;  // NOLINT
+      return true;
+    }
+    catch(...)
+    {
+    }
+    return false;
+  }
+  inline std::error_code exception_mapping_system_error(const void *object, const exception_mapping & /*unused*/) noexcept { return static_cast<const std::system_error *>(object)->code(); }
+
+  template <class E> inline exception_mapping make_exception_mapping(std::error_code constant, std::error_code (*f)(const E &) = nullptr) noexcept
+  {
+    exception_mapping ret;
+#if OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER
+    ret.type = &typeid(E);
+    ret.convert = (f != nullptr) ? &exception_mapping_user<E> : &exception_mapping_constant<E>;
+#endif
+    ret.rethrow_match = &exception_mapping_rethrow<E>;
+    ret.constant = constant;
+    ret.user = reinterpret_cast<void (*)()>(f);  // NOLINT
+    return ret;
+  }
+
+  /* User registered mappings, which take precedence over the built in ones. A registration
+  claims its slot by bumping `reserved`, fills it, then publishes it by bumping `count` once
+  all earlier slots are published, so readers only ever see fully written mappings.
+  */
+  struct exception_registry
+  {
+    exception_mapping mappings[OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE];
+    std::atomic<size_t> reserved{0};
+    std::atomic<size_t> count{0};
+  };
+  inline exception_registry &exception_classifier_registry() noexcept
+  {
+    static exception_registry v;
+    return v;
+  }
+
+#if OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER
+  // The same order as the catch ladder in error_from_exception()
+  static constexpr size_t builtin_exception_mappings_count = 10;
+  inline const exception_mapping *builtin_exception_mappings() noexcept
+  {
+    static const exception_mapping v[builtin_exception_mappings_count] = {
+    make_exception_mapping<std::invalid_argument>(std::make_error_code(std::errc::invalid_argument)),
+    make_exception_mapping<std::domain_error>(std::make_error_code(std::errc::argument_out_of_domain)),
+    make_exception_mapping<std::length_error>(std::make_error_code(std::errc::argument_list_too_long)),
+    make_exception_mapping<std::out_of_range>(std::make_error_code(std::errc::result_out_of_range)),
+    make_exception_mapping<std::logic_error>(std::make_error_code(std::errc::invalid_argument)),
+    [] {
+      auto ret = make_exception_mapping<std::system_error>({});
+      ret.convert = &exception_mapping_system_error;
+      return ret;
+    }(),
+    make_exception_mapping<std::overflow_error>(std::make_error_code(std::errc::value_too_large)),
+    make_exception_mapping<std::range_error>(std::make_error_code(std::errc::result_out_of_range)),
+    make_exception_mapping<std::runtime_error>(std::make_error_code(std::errc::resource_unavailable_try_again)),
+    make_exception_mapping<std::bad_alloc>(std::make_error_code(std::errc::not_enough_memory)),
+    };
+    return v;
+  }
+
+  /* Maps the dynamic type of a thrown object to the index of the mapping which catches it.
+  Indices below the registry size are user mappings, the remainder built in ones. Slots are
+  claimed by CAS on the type and published by storing the entry, so reads take no locks.
+  Each entry records how many user mappings were published when it was made, and is
+  ignored once more have been registered, as a newer mapping may take precedence.
+  */
+  struct exception_classifier_cache
+  {
+    static constexpr int pending = -2;  // not known for the current user mappings
+    static constexpr int unmatched = -1;
+
+    struct slot
+    {
+      std::atomic<const std::type_info *> type{nullptr};
+      std::atomic<uint32_t> entry{0};  // zero until published
+    };
+    slot slots[OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE];
+
+    static size_t hash(const std::type_info *t) noexcept { return (reinterpret_cast<uintptr_t>(t) >> 4U) & (OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE - 1); }
+    static uint32_t make_entry(size_t usercount, int index) noexcept { return static_cast<uint32_t>(usercount << 16U) | static_cast<uint32_t>(index + 2); }
+
+    // Returns `pending` if not known
+    int find(const std::type_info *t, size_t usercount) const noexcept
+    {
+      for(size_t n = 0, h = hash(t); n < OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE; n++)
+      {
+        const slot &s = slots[(h + n) & (OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE - 1)];
+        const std::type_info *k = s.type.load(std::memory_order_acquire);
+        if(k == t)
+        {
+          const uint32_t e = s.entry.load(std::memory_order_acquire);
+          return (e != 0 && (e >> 16U) == usercount) ? static_cast<int>(e & 0xffffU) - 2 : pending;
+        }
+        if(k == nullptr)
+        {
+          break;
+        }
+      }
+      return pending;
+    }
+    void insert(const std::type_info *t, size_t usercount, int index) noexcept
+    {
+      for(size_t n = 0, h = hash(t); n < OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE; n++)
+      {
+        slot &s = slots[(h + n) & (OUTCOME_EXCEPTION_CLASSIFIER_CACHE_SIZE - 1)];
+        const std::type_info *expected = nullptr;
+        if(s.type.compare_exchange_strong(expected, t, std::memory_order_acq_rel, std::memory_order_acquire) || expected == t)
+        {
+          // A racing thread may store an entry for fewer user mappings, which only costs a reclassification
+          s.entry.store(make_entry(usercount, index), std::memory_order_release);
+          return;
+        }
+      }
+      // Full, which only costs the slow classification next time
+    }
+  };
+  inline exception_classifier_cache &exception_classifier_cache_instance() noexcept
+  {
+    static exception_classifier_cache v;
+    return v;
+  }
+
+  inline const exception_mapping &exception_mapping_at(int index) noexcept
+  {
+    return (index < OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE) ? exception_classifier_registry().mappings[index] : builtin_exception_mappings()[index - OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE];
+  }
+
+  // libstdc++'s exception_ptr is a pointer to the thrown object
+  inline void *exception_ptr_object(const std::exception_ptr &ep) noexcept
+  {
+    static_assert(sizeof(std::exception_ptr) == sizeof(void *), "std::exception_ptr is not the expected layout");
+    void *ret = nullptr;
+    std::memcpy(&ret, &ep, sizeof(ret));
+    return ret;
+  }
+#endif
+
+  enum class exception_classification
+  {
+    matched,
+    unmatched,
+    unknown  // the fast path cannot see inside this exception_ptr
+  };
+
+  /* Classify `ep` using its dynamic type where possible. Only a type's first appearance
+  walks the mappings, each later appearance is a cache lookup and the conversion.
+  */
+  inline exception_classification classify_exception(const std::exception_ptr &ep, std::error_code &out) noexcept
+  {
+#if OUTCOME_HAVE_FAST_EXCEPTION_CLASSIFIER
+    const std::type_info *thrown = ep.__cxa_exception_type();
+    if(thrown == nullptr)
+    {
+      return exception_classification::unknown;
+    }
+    auto &cache = exception_classifier_cache_instance();
+    const size_t usercount = exception_classifier_registry().count.load(std::memory_order_acquire);
+    int index = cache.find(thrown, usercount);
+    void *object = exception_ptr_object(ep);
+    // __do_catch() adjusts object to the base class subobject, and must succeed before it is converted
+    if(index >= 0 && !exception_mapping_at(index).type->__do_catch(thrown, &object, 1))
+    {
+      index = exception_classifier_cache::pending;
+    }
+    if(index == exception_classifier_cache::pending)
+    {
+      index = exception_classifier_cache::unmatched;
+      for(size_t n = 0; n < usercount + builtin_exception_mappings_count && index == exception_classifier_cache::unmatched; n++)
+      {
+        const int i = (n < usercount) ? static_cast<int>(n) : static_cast<int>(OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE + n - usercount);
+        object = exception_ptr_object(ep);
+        if(exception_mapping_at(i).type->__do_catch(thrown, &object, 1))
+        {
+          index = i;
+        }
+      }
+      cache.insert(thrown, usercount, index);
+    }
+    if(index == exception_classifier_cache::unmatched)
+    {
+      return exception_classification::unmatched;
+    }
+    const exception_mapping &m = exception_mapping_at(index);
+    out = m.convert(object, m);
+    return exception_classification::matched;
+#else
+    auto &registry = exception_classifier_registry();
+    const size_t usercount = registry.count.load(std::memory_order_acquire);
+    for(size_t n = 0; n < usercount; n++)
+    {
+      if(registry.mappings[n].rethrow_match(ep, registry.mappings[n], out))
+      {
+        return exception_classification::matched;
+      }
+    }
+    return exception_classification::unknown;
+#endif
+  }
+
+  inline bool register_exception_mapping(const exception_mapping &m) noexcept
+  {
+    auto &registry = exception_classifier_registry();
+    size_t n = registry.reserved.load(std::memory_order_relaxed);
+    do
+    {
+      if(n == OUTCOME_EXCEPTION_CLASSIFIER_REGISTRY_SIZE)
+      {
+        return false;
+      }
+    } while(!registry.reserved.compare_exchange_weak(n, n + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+    registry.mappings[n] = m;
+    // Publish in slot order. Cache entries made for fewer mappings are thereafter ignored.
+    for(size_t expected = n; !registry.count.compare_exchange_weak(expected, n + 1, std::memory_order_release, std::memory_order_relaxed); expected = n)
+    {
+    }
+    return true;
+  }
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+#endif
+
+#endif
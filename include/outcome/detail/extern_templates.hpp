@@ -0,0 +1,60 @@
+/* Extern template declarations of result and outcome specialisations
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXTERN_TEMPLATES_HPP
+#define OUTCOME_EXTERN_TEMPLATES_HPP
+
+#ifndef OUTCOME_EXTERN_TEMPLATE
+// Defined to nothing by the translation unit which explicitly instantiates the specialisations
+#define OUTCOME_EXTERN_TEMPLATE extern
+#endif
+
+/* Every class in the inheritance chain is named, as explicitly instantiating a class does
+not instantiate its bases, and the observers live in the bases.
+*/
+#define OUTCOME_EXTERN_TEMPLATE_BASIC_RESULT_BASES(R, S, ...)                                                                                                  \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_result_storage<R, S, __VA_ARGS__>;                                                                     \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_result_value_observers<detail::basic_result_storage<R, S, __VA_ARGS__>, R, __VA_ARGS__>;                \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_result_error_observers<                                                                                 \
+  detail::basic_result_value_observers<detail::basic_result_storage<R, S, __VA_ARGS__>, R, __VA_ARGS__>, S, __VA_ARGS__>;                                      \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_result_final<R, S, __VA_ARGS__>
+
+//! Declares, or within the instantiating translation unit defines, `result<R>` and its bases
+#define OUTCOME_EXTERN_TEMPLATE_RESULT(R)                                                                                                                      \
+  OUTCOME_EXTERN_TEMPLATE_BASIC_RESULT_BASES(R, std::error_code, policy::default_policy<R, std::error_code, void>);                                            \
+  OUTCOME_EXTERN_TEMPLATE template class basic_result<R, std::error_code, policy::default_policy<R, std::error_code, void>>
+
+//! Declares, or within the instantiating translation unit defines, `outcome<R>` and its bases
+#define OUTCOME_EXTERN_TEMPLATE_OUTCOME(R)                                                                                                                     \
+  OUTCOME_EXTERN_TEMPLATE_BASIC_RESULT_BASES(R, std::error_code, policy::default_policy<R, std::error_code, std::exception_ptr>);                              \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_outcome_exception_observers<                                                                            \
+  detail::basic_result_final<R, std::error_code, policy::default_policy<R, std::error_code, std::exception_ptr>>, R, std::error_code, std::exception_ptr,      \
+  policy::default_policy<R, std::error_code, std::exception_ptr>>;                                                                                            \
+  OUTCOME_EXTERN_TEMPLATE template class detail::basic_outcome_failure_observers<                                                                              \
+  detail::basic_outcome_exception_observers<detail::basic_result_final<R, std::error_code, policy::default_policy<R, std::error_code, std::exception_ptr>>,   \
+                                            R, std::error_code, std::exception_ptr, policy::default_policy<R, std::error_code, std::exception_ptr>>,          \
+  R, std::error_code, std::exception_ptr, policy::default_policy<R, std::error_code, std::exception_ptr>>;                                                    \
+  OUTCOME_EXTERN_TEMPLATE template class basic_outcome<R, std::error_code, std::exception_ptr, policy::default_policy<R, std::error_code, std::exception_ptr>>
+
+#endif
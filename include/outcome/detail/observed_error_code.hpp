@@ -0,0 +1,138 @@
+/* Error code bridge shared by the telemetry and sampled backtrace features
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_OBSERVED_ERROR_CODE_HPP
+#define OUTCOME_DETAIL_OBSERVED_ERROR_CODE_HPP
+
+#include "../outcome.hpp"
+
+#include <atomic>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  /* `observed::error_code` is an ADL bridge type, so that results and outcomes of it find the
+  hooks below. Those fan every errored construction out to each observer registered by a
+  feature header, such as `<outcome/telemetry.hpp>` and `<outcome/sampled_backtrace.hpp>`.
+  Every feature included anywhere in the program therefore sees every observed result.
+  */
+  namespace observed
+  {
+    struct error_code : public std::error_code
+    {
+      using std::error_code::error_code;
+      error_code() = default;
+      error_code(std::error_code ec)  // NOLINT
+      : std::error_code(ec)
+      {
+      }
+    };
+    // Keep the errno bit working for the bridge type
+    template <class State> constexpr inline void _set_error_is_errno(State &state, const error_code &error)
+    {
+      OUTCOME_V2_NAMESPACE::detail::_set_error_is_errno(state, static_cast<const std::error_code &>(error));
+    }
+
+    // Called with the error of each errored construction, and its spare storage which the observer may update
+    using observer = void (*)(const std::error_code &ec, uint16_t &spare_storage);
+    static constexpr size_t max_observers = 4;
+
+    inline std::atomic<observer> *observers() noexcept
+    {
+      static std::atomic<observer> v[max_observers];
+      return v;
+    }
+    // Observers fill slots in order and are never removed. Adding the same observer twice does nothing.
+    inline bool add_observer(observer o) noexcept
+    {
+      for(size_t n = 0; n < max_observers; n++)
+      {
+        observer expected = nullptr;
+        if(observers()[n].compare_exchange_strong(expected, o, std::memory_order_acq_rel, std::memory_order_acquire) || expected == o)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+    // Each feature header has one of these per translation unit, which registers its observer during static initialisation
+    struct observer_registration
+    {
+      explicit observer_registration(observer o) noexcept { (void) add_observer(o); }
+    };
+
+    template <class T> inline void notify_if_errored(T *res) noexcept
+    {
+      if(res->has_error())
+      {
+        uint16_t spare = OUTCOME_V2_NAMESPACE::hooks::spare_storage(res);
+        for(size_t n = 0; n < max_observers; n++)
+        {
+          const observer o = observers()[n].load(std::memory_order_acquire);
+          if(o == nullptr)
+          {
+            break;
+          }
+          o(res->assume_error(), spare);
+        }
+        OUTCOME_V2_NAMESPACE::hooks::set_spare_storage(res, spare);
+      }
+    }
+
+    template <class R> using result = OUTCOME_V2_NAMESPACE::result<R, error_code>;
+    template <class R> using outcome = OUTCOME_V2_NAMESPACE::outcome<R, error_code>;
+
+    /* Errored constructions from values, errors, in place and from `failure_type` are observed.
+    Conversions from another result or outcome are not, as those were observed when first made,
+    and they keep the spare storage of their source.
+    */
+    template <class T, class U> inline void hook_result_construction(result<T> *res, U && /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class... Args> inline void hook_result_in_place_construction(result<T> *res, in_place_type_t<U> /*unused*/, Args &&... /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class V> inline void hook_result_copy_construction(result<T> *res, const failure_type<U, V> & /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class V> inline void hook_result_move_construction(result<T> *res, failure_type<U, V> && /*unused*/) noexcept { notify_if_errored(res); }
+
+    template <class T, class... U> inline void hook_outcome_construction(outcome<T> *res, U &&... /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class... Args> inline void hook_outcome_in_place_construction(outcome<T> *res, in_place_type_t<U> /*unused*/, Args &&... /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class V> inline void hook_outcome_copy_construction(outcome<T> *res, const failure_type<U, V> & /*unused*/) noexcept { notify_if_errored(res); }
+    template <class T, class U, class V> inline void hook_outcome_move_construction(outcome<T> *res, failure_type<U, V> && /*unused*/) noexcept { notify_if_errored(res); }
+  }  // namespace observed
+}  // namespace detail
+
+namespace trait
+{
+  // The bridge type is an error type exactly as std::error_code is
+  template <> struct is_error_type<OUTCOME_V2_NAMESPACE::detail::observed::error_code>
+  {
+    static constexpr bool value = true;
+  };
+  template <class Enum> struct is_error_type_enum<OUTCOME_V2_NAMESPACE::detail::observed::error_code, Enum>
+  {
+    static constexpr bool value = std::is_error_condition_enum<Enum>::value;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
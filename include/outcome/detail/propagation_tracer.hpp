@@ -0,0 +1,219 @@
+/* Opt-in error propagation path tracer
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_PROPAGATION_TRACER_HPP
+#define OUTCOME_DETAIL_PROPAGATION_TRACER_HPP
+
+/* When OUTCOME_ENABLE_PROPAGATION_TRACER is defined to 1, every failure propagated by
+OUTCOME_TRY appends its `__FILE__` and `__LINE__` to a hop list in a thread local arena.
+The arena record is keyed by the spare storage of the propagated result, and the key is
+handed to the result constructed from the returned `failure_type` so the next TRY finds
+the same record. The key is only handed over while the TRY's return statement runs. In
+this mode the tracer owns the low OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS bits of
+spare storage, the rest are left to other users such as sampled backtraces.
+*/
+#ifndef OUTCOME_ENABLE_PROPAGATION_TRACER
+#define OUTCOME_ENABLE_PROPAGATION_TRACER 0
+#endif
+
+#ifndef OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS
+#if OUTCOME_ENABLE_PROPAGATION_TRACER
+#define OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS 8
+#else
+#define OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS 0
+#endif
+#endif
+
+#if OUTCOME_ENABLE_PROPAGATION_TRACER
+#ifndef OUTCOME_IS_CONSTANT_EVALUATED
+#error "The propagation tracer requires a compiler providing __builtin_is_constant_evaluated()"
+#endif
+
+#include <cstring>
+
+#ifndef OUTCOME_PROPAGATION_TRACER_RECORDS
+//! The number of in flight failures each thread tracks. Must be a power of two.
+#define OUTCOME_PROPAGATION_TRACER_RECORDS 256
+#endif
+#ifndef OUTCOME_PROPAGATION_TRACER_MAX_HOPS
+//! The number of propagation sites kept per failure. Further hops are counted but not kept.
+#define OUTCOME_PROPAGATION_TRACER_MAX_HOPS 16
+#endif
+#ifndef OUTCOME_PROPAGATION_TRACER_ORIGINS
+//! The number of distinct origins each thread keeps histograms for.
+#define OUTCOME_PROPAGATION_TRACER_ORIGINS 64
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  static_assert((OUTCOME_PROPAGATION_TRACER_RECORDS & (OUTCOME_PROPAGATION_TRACER_RECORDS - 1)) == 0, "OUTCOME_PROPAGATION_TRACER_RECORDS must be a power of two");
+  static_assert(OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS > 0 && OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS < 16, "OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS must leave bits of spare storage for others");
+  static_assert(OUTCOME_PROPAGATION_TRACER_RECORDS <= (1U << OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS), "OUTCOME_PROPAGATION_TRACER_RECORDS must fit into the tracer's bits of spare storage");
+
+  static constexpr uint16_t propagation_key_mask = static_cast<uint16_t>((1U << OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS) - 1);
+  constexpr inline uint16_t propagation_key_of(uint16_t spare_storage) noexcept { return static_cast<uint16_t>(spare_storage & propagation_key_mask); }
+  constexpr inline uint16_t with_propagation_key(uint16_t spare_storage, uint16_t key) noexcept
+  {
+    return static_cast<uint16_t>((spare_storage & ~propagation_key_mask) | key);
+  }
+
+  struct propagation_site
+  {
+    const char *file{nullptr};
+    unsigned line{0};
+
+    bool operator==(const propagation_site &o) const noexcept { return line == o.line && (file == o.file || (file != nullptr && o.file != nullptr && 0 == std::strcmp(file, o.file))); }
+  };
+  struct propagation_record
+  {
+    uint16_t tag{0};  // zero means unused
+    uint32_t hops{0};
+    propagation_site sites[OUTCOME_PROPAGATION_TRACER_MAX_HOPS];  // sites[0] is where the failure was first propagated
+  };
+  // Buckets are hop counts, the last bucket counts everything at or beyond it
+  struct propagation_histogram
+  {
+    propagation_site origin;
+    uint64_t buckets[OUTCOME_PROPAGATION_TRACER_MAX_HOPS + 1];
+  };
+
+  struct propagation_arena
+  {
+    propagation_record records[OUTCOME_PROPAGATION_TRACER_RECORDS];
+    // Histograms of failures whose records have been recycled
+    propagation_histogram finished[OUTCOME_PROPAGATION_TRACER_ORIGINS];
+    size_t finished_count{0};
+    uint64_t finished_dropped{0};
+    uint16_t last_tag{0};
+    uint16_t pending{0};  // the key for the result the current TRY's return statement constructs
+
+    propagation_record *find(uint16_t tag) noexcept
+    {
+      if(tag == 0)
+      {
+        return nullptr;
+      }
+      propagation_record &r = records[tag & (OUTCOME_PROPAGATION_TRACER_RECORDS - 1)];
+      return (r.tag == tag) ? &r : nullptr;
+    }
+
+    void fold(const propagation_record &r) noexcept
+    {
+      const uint32_t bucket = (r.hops < OUTCOME_PROPAGATION_TRACER_MAX_HOPS) ? r.hops : OUTCOME_PROPAGATION_TRACER_MAX_HOPS;
+      for(size_t n = 0; n < finished_count; n++)
+      {
+        if(finished[n].origin == r.sites[0])
+        {
+          finished[n].buckets[bucket]++;
+          return;
+        }
+      }
+      if(finished_count == OUTCOME_PROPAGATION_TRACER_ORIGINS)
+      {
+        finished_dropped++;
+        return;
+      }
+      propagation_histogram &h = finished[finished_count++];
+      h.origin = r.sites[0];
+      for(auto &i : h.buckets)
+      {
+        i = 0;
+      }
+      h.buckets[bucket] = 1;
+    }
+
+    void hop(uint16_t tag, const char *file, unsigned line) noexcept
+    {
+      pending = 0;
+      propagation_record *r = find(tag);
+      if(r == nullptr)
+      {
+        // A failure never propagated before, or one whose record has since been recycled
+        last_tag = (last_tag == propagation_key_mask) ? 1 : static_cast<uint16_t>(last_tag + 1);
+        r = &records[last_tag & (OUTCOME_PROPAGATION_TRACER_RECORDS - 1)];
+        if(r->tag != 0)
+        {
+          fold(*r);
+        }
+        r->tag = last_tag;
+        r->hops = 0;
+      }
+      if(r->hops < OUTCOME_PROPAGATION_TRACER_MAX_HOPS)
+      {
+        r->sites[r->hops] = {file, line};
+      }
+      r->hops++;
+      pending = r->tag;
+    }
+  };
+
+  // Meyers' singleton returning the thread local propagation arena for this thread
+  inline propagation_arena &my_propagation_arena() noexcept
+  {
+    static OUTCOME_THREAD_LOCAL propagation_arena v;
+    return v;
+  }
+
+  /* OUTCOME_TRY's return statement holds one of these as a temporary, which lives until
+  the returned result has been constructed. The pending key can therefore only be adopted
+  by that result, and never by some later unrelated construction from a `failure_type`.
+  */
+  struct propagation_scope
+  {
+    propagation_scope() = default;
+    propagation_scope(const propagation_scope &) = delete;
+    propagation_scope &operator=(const propagation_scope &) = delete;
+    ~propagation_scope() { my_propagation_arena().pending = 0; }
+  };
+  inline void propagation_tracer_hop(uint16_t key, const char *file, unsigned line) noexcept { my_propagation_arena().hop(key, file, line); }
+  inline uint16_t propagation_tracer_adopt() noexcept
+  {
+    propagation_arena &a = my_propagation_arena();
+    const uint16_t ret = a.pending;
+    a.pending = 0;
+    return ret;
+  }
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+// Used by the constructors from failure_type to pick up the record of the failure being propagated
+#define OUTCOME_PROPAGATION_TRACER_ADOPT(self)                                                                                                                 \
+  do                                                                                                                                                           \
+  {                                                                                                                                                            \
+    if(!OUTCOME_IS_CONSTANT_EVALUATED())                                                                                                                       \
+    {                                                                                                                                                          \
+      const uint16_t _outcome_propagation_key = OUTCOME_V2_NAMESPACE::detail::propagation_tracer_adopt();                                                      \
+      if(_outcome_propagation_key != 0)                                                                                                                        \
+      {                                                                                                                                                        \
+        OUTCOME_V2_NAMESPACE::hooks::set_spare_storage(                                                                                                        \
+        self, OUTCOME_V2_NAMESPACE::detail::with_propagation_key(OUTCOME_V2_NAMESPACE::hooks::spare_storage(self), _outcome_propagation_key));                 \
+      }                                                                                                                                                        \
+    }                                                                                                                                                          \
+  } while(0)
+#else
+#define OUTCOME_PROPAGATION_TRACER_ADOPT(self)
+#endif
+
+#endif
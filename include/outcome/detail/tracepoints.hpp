@@ -0,0 +1,120 @@
+/* Opt-in Linux SDT static tracepoints
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_TRACEPOINTS_HPP
+#define OUTCOME_DETAIL_TRACEPOINTS_HPP
+
+/* When OUTCOME_ENABLE_TRACEPOINTS is defined to 1, SDT probes with provider `outcome` are
+placed into the result and outcome constructors, `try_operation_return_as()` and the
+throwing paths of the policy `wide_value_check()`. A probe is a single nop plus an ELF note,
+so costs nothing until perf, bpftrace or systemtap attaches to it. Probes are inlined into
+each call site, so the probe address identifies the constructing or propagating code.
+
+Probes:
+
+- `outcome:result_construct(void *self, unsigned status)`
+- `outcome:outcome_construct(void *self, unsigned status)`
+- `outcome:try_return(void *source)`
+- `outcome:value_check_throw(void *self)`
+*/
+#ifndef OUTCOME_ENABLE_TRACEPOINTS
+#define OUTCOME_ENABLE_TRACEPOINTS 0
+#endif
+
+#if OUTCOME_ENABLE_TRACEPOINTS
+#ifdef __has_include
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define OUTCOME_TRACEPOINT_PROBE1(name, a1) STAP_PROBE1(outcome, name, a1)
+#define OUTCOME_TRACEPOINT_PROBE2(name, a1, a2) STAP_PROBE2(outcome, name, a1, a2)
+#endif
+#endif
+/* Without <sys/sdt.h>, emit the same version 3 stapsdt note that it would for the
+common 64 bit ELF targets. Arguments are always passed in registers.
+*/
+#if !defined(OUTCOME_TRACEPOINT_PROBE1) && defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__)) && (defined(__GNUC__) || defined(__clang__))
+#define OUTCOME_TRACEPOINT_SDT_ASM(name, args)                                                                                                                 \
+  "990: nop\n"                                                                                                                                                 \
+  ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                                                                                                \
+  ".balign 4\n"                                                                                                                                                \
+  ".4byte 992f-991f, 994f-993f, 3\n"                                                                                                                           \
+  "991: .asciz \"stapsdt\"\n"                                                                                                                                  \
+  "992: .balign 4\n"                                                                                                                                           \
+  "993: .8byte 990b\n"                                                                                                                                         \
+  ".8byte _.stapsdt.base\n"                                                                                                                                    \
+  ".8byte 0\n"                                                                                                                                                 \
+  ".asciz \"outcome\"\n"                                                                                                                                       \
+  ".asciz \"" #name "\"\n"                                                                                                                                     \
+  ".asciz \"" args "\"\n"                                                                                                                                      \
+  "994: .balign 4\n"                                                                                                                                           \
+  ".popsection\n"                                                                                                                                              \
+  ".ifndef _.stapsdt.base\n"                                                                                                                                   \
+  ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"                                                                                      \
+  ".weak _.stapsdt.base\n"                                                                                                                                     \
+  ".hidden _.stapsdt.base\n"                                                                                                                                   \
+  "_.stapsdt.base: .space 1\n"                                                                                                                                 \
+  ".size _.stapsdt.base, 1\n"                                                                                                                                  \
+  ".popsection\n"                                                                                                                                              \
+  ".endif\n"
+#define OUTCOME_TRACEPOINT_PROBE1(name, a1) __asm__ __volatile__(OUTCOME_TRACEPOINT_SDT_ASM(name, "8@%[_outcome_a1]")::[_outcome_a1] "r"(a1))
+#define OUTCOME_TRACEPOINT_PROBE2(name, a1, a2) __asm__ __volatile__(OUTCOME_TRACEPOINT_SDT_ASM(name, "8@%[_outcome_a1] 4@%[_outcome_a2]")::[_outcome_a1] "r"(a1), [_outcome_a2] "r"(a2))
+#endif
+#endif
+
+#if defined(OUTCOME_TRACEPOINT_PROBE1) && defined(OUTCOME_IS_CONSTANT_EVALUATED)
+#define OUTCOME_HAVE_TRACEPOINTS 1
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  // Always inlined so each call site gets its own probe address
+  template <class S> __attribute__((always_inline)) inline void tracepoint_result_construct(const void *self, S status) noexcept
+  {
+    const unsigned s = static_cast<unsigned>(status);
+    OUTCOME_TRACEPOINT_PROBE2(result_construct, self, s);
+  }
+  template <class S> __attribute__((always_inline)) inline void tracepoint_outcome_construct(const void *self, S status) noexcept
+  {
+    const unsigned s = static_cast<unsigned>(status);
+    OUTCOME_TRACEPOINT_PROBE2(outcome_construct, self, s);
+  }
+  __attribute__((always_inline)) inline void tracepoint_try_return(const void *source) noexcept { OUTCOME_TRACEPOINT_PROBE1(try_return, source); }
+  __attribute__((always_inline)) inline void tracepoint_value_check_throw(const void *self) noexcept { OUTCOME_TRACEPOINT_PROBE1(value_check_throw, self); }
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#define OUTCOME_TRACEPOINT(name, ...)                                                                                                                          \
+  do                                                                                                                                                           \
+  {                                                                                                                                                            \
+    if(!OUTCOME_IS_CONSTANT_EVALUATED())                                                                                                                       \
+    {                                                                                                                                                          \
+      OUTCOME_V2_NAMESPACE::detail::tracepoint_##name(__VA_ARGS__);                                                                                            \
+    }                                                                                                                                                          \
+  } while(0)
+#else
+#define OUTCOME_HAVE_TRACEPOINTS 0
+#define OUTCOME_TRACEPOINT(name, ...)
+#endif
+
+#endif
@@ -60,6 +60,16 @@ namespace detail
       state._status.set_have_error_is_errno(true);
    }
 
+  // identical() compares category identity, not category equality which may be a virtual call
+  template <> struct identical_payload<std::error_code>
+  {
+    static bool equal(const std::error_code &a, const std::error_code &b) noexcept { return a.value() == b.value() && &a.category() == &b.category(); }
+  };
+  template <> struct identical_payload<std::error_condition>
+  {
+    static bool equal(const std::error_condition &a, const std::error_condition &b) noexcept { return a.value() == b.value() && &a.category() == &b.category(); }
+  };
+
 }  // namespace detail
 
 namespace policy
@@ -276,6 +276,11 @@ namespace detail
       return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_moved_from)) != 0;
 #endif
     }
+    // True if both agree on the status bits in `mask`
+    constexpr bool have_same(const status_bitfield_type &o, uint16_t mask) const noexcept
+    {
+      return ((static_cast<uint16_t>(status_value) ^ static_cast<uint16_t>(o.status_value)) & mask) == 0;
+    }
 
     constexpr status_bitfield_type &set_have_value(bool v) noexcept
     {
@@ -25,8 +25,10 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_EXPERIMENTAL_RESULT_H
 #define OUTCOME_EXPERIMENTAL_RESULT_H
 
+#include <stddef.h>  // for size_t
 #include <stdint.h>  // for intptr_t
 
+
 #define CXX_DECLARE_RESULT(ident, R, S)                                                                                                                                                                                                                                                                                        \
   struct cxx_result_##ident                                                                                                                                                                                                                                                                                                    \
   {                                                                                                                                                                                                                                                                                                                            \
@@ -44,6 +46,103 @@ Distributed under the Boost Software License, Version 1.0.
 
 #define CXX_RESULT_ERROR_IS_ERRNO(r) (((r).flags & (1U << 4U)) == (1U << 4U))
 
+/***************************** Arrays of results ******************************/
+
+/* The C++ status bitfield is four bytes, with the status bits in the low half, so
+`flags` must be a four byte unsigned int for the C and C++ views to agree.
+*/
+#if defined(__cplusplus)
+static_assert(sizeof(unsigned) == 4, "CXX_DECLARE_RESULT requires a four byte unsigned int");
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof(unsigned) == 4, "CXX_DECLARE_RESULT requires a four byte unsigned int");
+#endif
+
+#ifdef __cplusplus
+/* The offsets of the value, flags and error members of a C++ result type. The C++ type
+stores a union holding the value, then the four byte status bitfield, then the error,
+so these are where a standard layout struct of those three members would place them.
+*/
+constexpr inline size_t cxx_result_layout_round_up(size_t n, size_t align) { return (n + align - 1) / align * align; }
+template <class T> struct cxx_result_layout
+{
+  static constexpr size_t value_offset = 0;
+  static constexpr size_t value_size = sizeof(typename T::value_type);
+  static constexpr size_t flags_offset = cxx_result_layout_round_up(sizeof(typename T::value_type), alignof(unsigned));
+  static constexpr size_t error_offset = cxx_result_layout_round_up(flags_offset + sizeof(unsigned), alignof(typename T::error_type));
+  static constexpr size_t error_size = sizeof(typename T::error_type);
+};
+
+/* Use this in C++ to check that a result type declared with CXX_DECLARE_RESULT has the
+same size, alignment and member offsets as the C++ type, with value and error members of
+the same sizes, so arrays of either can be passed for the other.
+*/
+#define CXX_RESULT_STATIC_ASSERT_LAYOUT(ident, ...)                                                                                                                                                                                                                                                                            \
+  static_assert(sizeof(CXX_RESULT(ident)) == sizeof(__VA_ARGS__), "C and C++ result types differ in size");                                                                                                                                                                                                                    \
+  static_assert(alignof(CXX_RESULT(ident)) == alignof(__VA_ARGS__), "C and C++ result types differ in alignment");                                                                                                                                                                                                             \
+  static_assert(offsetof(CXX_RESULT(ident), value) == cxx_result_layout<__VA_ARGS__>::value_offset, "C and C++ result types differ in layout");                                                                                                                                                                                \
+  static_assert(offsetof(CXX_RESULT(ident), flags) == cxx_result_layout<__VA_ARGS__>::flags_offset, "C and C++ result types differ in layout");                                                                                                                                                                                \
+  static_assert(offsetof(CXX_RESULT(ident), error) == cxx_result_layout<__VA_ARGS__>::error_offset, "C and C++ result types differ in layout");                                                                                                                                                                                \
+  static_assert(sizeof(cxx_result_##ident::value) == cxx_result_layout<__VA_ARGS__>::value_size, "C and C++ result types differ in layout");                                                                                                                                                                                   \
+  static_assert(sizeof(cxx_result_##ident::error) == cxx_result_layout<__VA_ARGS__>::error_size, "C and C++ result types differ in layout")
+#endif
+
+/* Declares helpers for arrays of a result type previously declared with CXX_DECLARE_RESULT.
+The first failure search returns `count` if all results have values. The status bitmap has
+bit `n % 64` of `bitmap[n / 64]` set if result `n` has a value, and returns how many failed.
+*/
+#define CXX_DECLARE_RESULT_ARRAY(ident)                                                                                                                                                                                                                                                                                        \
+  static inline size_t cxx_result_##ident##_first_failure(const struct cxx_result_##ident *results, size_t count)                                                                                                                                                                                                              \
+  {                                                                                                                                                                                                                                                                                                                            \
+    size_t n;                                                                                                                                                                                                                                                                                                                  \
+    for(n = 0; n < count; n++)                                                                                                                                                                                                                                                                                                 \
+    {                                                                                                                                                                                                                                                                                                                          \
+      if(!CXX_RESULT_HAS_VALUE(results[n]))                                                                                                                                                                                                                                                                                    \
+      {                                                                                                                                                                                                                                                                                                                        \
+        break;                                                                                                                                                                                                                                                                                                                 \
+      }                                                                                                                                                                                                                                                                                                                        \
+    }                                                                                                                                                                                                                                                                                                                          \
+    return n;                                                                                                                                                                                                                                                                                                                  \
+  }                                                                                                                                                                                                                                                                                                                            \
+  static inline size_t cxx_result_##ident##_status_bitmap(uint64_t *bitmap, const struct cxx_result_##ident *results, size_t count)                                                                                                                                                                                            \
+  {                                                                                                                                                                                                                                                                                                                            \
+    size_t n, failures = 0;                                                                                                                                                                                                                                                                                                    \
+    for(n = 0; n < count; n += 64)                                                                                                                                                                                                                                                                                             \
+    {                                                                                                                                                                                                                                                                                                                          \
+      const size_t end = (count - n < 64) ? count - n : 64;                                                                                                                                                                                                                                                                    \
+      uint64_t word = 0;                                                                                                                                                                                                                                                                                                       \
+      size_t i;                                                                                                                                                                                                                                                                                                                \
+      for(i = 0; i < end; i++)                                                                                                                                                                                                                                                                                                 \
+      {                                                                                                                                                                                                                                                                                                                        \
+        word |= (uint64_t)(results[n + i].flags & 1U) << i;                                                                                                                                                                                                                                                                    \
+        failures += (results[n + i].flags & 1U) ^ 1U;                                                                                                                                                                                                                                                                          \
+      }                                                                                                                                                                                                                                                                                                                        \
+      bitmap[n / 64] = word;                                                                                                                                                                                                                                                                                                   \
+    }                                                                                                                                                                                                                                                                                                                          \
+    return failures;                                                                                                                                                                                                                                                                                                           \
+  }                                                                                                                                                                                                                                                                                                                            \
+  typedef int cxx_result_##ident##_array_declared
+
+#define CXX_RESULT_ARRAY_FIRST_FAILURE(ident, results, count) cxx_result_##ident##_first_failure((results), (count))
+
+#define CXX_RESULT_ARRAY_STATUS_BITMAP(ident, bitmap, results, count) cxx_result_##ident##_status_bitmap((bitmap), (results), (count))
+
+/* Declares a loop filling `errnos[n]` with zero if result `n` has a value, its error if
+that is an errno code, else with `other`. Returns how many failed.
+*/
+#define CXX_DECLARE_RESULT_TO_ERRNO_ARRAY(ident)                                                                                                                                                                                                                                                                               \
+  static inline size_t cxx_result_##ident##_to_errno(int *errnos, const struct cxx_result_##ident *results, size_t count, int other)                                                                                                                                                                                           \
+  {                                                                                                                                                                                                                                                                                                                            \
+    size_t n, failures = 0;                                                                                                                                                                                                                                                                                                    \
+    for(n = 0; n < count; n++)                                                                                                                                                                                                                                                                                                 \
+    {                                                                                                                                                                                                                                                                                                                          \
+      const unsigned flags = results[n].flags;                                                                                                                                                                                                                                                                                 \
+      failures += (flags & 1U) ^ 1U;                                                                                                                                                                                                                                                                                           \
+      errnos[n] = (flags & 1U) ? 0 : ((flags & (1U << 4U)) ? (int) results[n].error.value : other);                                                                                                                                                                                                                            \
+    }                                                                                                                                                                                                                                                                                                                          \
+    return failures;                                                                                                                                                                                                                                                                                                           \
+  }                                                                                                                                                                                                                                                                                                                            \
+  typedef int cxx_result_##ident##_to_errno_declared
+
 
 /***************************** <system_error2> support ******************************/
 
@@ -56,6 +155,41 @@ Distributed under the Boost Software License, Version 1.0.
 
 #define CXX_STATUS_CODE(ident) struct cxx_status_code_##ident
 
+/* A descriptor for the domain of a status code, as returned by
+cxx_status_code_domain_lookup(). Descriptors live until the process exits.
+*/
+struct cxx_status_code_domain_info
+{
+  // The first domain object with this id which was looked up
+  const void *domain;
+  // The unique id of the domain, the same in every process
+  unsigned long long id;
+  // The name of the domain
+  const char *name;
+  // Unique per domain id, so the same for every copy of a domain, and less than OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS
+  unsigned index;
+  // CXX_STATUS_CODE_DOMAIN_ERRNO if codes in this domain are errno values
+  unsigned flags;
+  // Returns the interned message for a value in this domain, or null if it could not be interned.
+  // Always null for domains not flagged CXX_STATUS_CODE_DOMAIN_ERRNO, whose values may not be
+  // reinterpreted as an intptr_t or may point to storage which is later reused.
+  const char *(*message)(const struct cxx_status_code_domain_info *info, intptr_t value);
+};
+
+#define CXX_STATUS_CODE_DOMAIN_ERRNO (1U)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  // Returns null if `domain` is null, the registry is full, or memory could not be allocated. Defined by <outcome/experimental/status_code_domain_registry.hpp>.
+  extern const struct cxx_status_code_domain_info *cxx_status_code_domain_lookup(const void *domain);
+#ifdef __cplusplus
+}
+#endif
+
+#define CXX_STATUS_CODE_MESSAGE(info, code) ((info)->message((info), (intptr_t)(code).value))
+
 
 struct cxx_status_code_posix
 {
@@ -64,6 +198,12 @@ struct cxx_status_code_posix
 };
 #define CXX_DECLARE_RESULT_ERRNO(ident, R) CXX_DECLARE_RESULT(posix_##ident, R, struct cxx_status_code_posix)
 #define CXX_RESULT_ERRNO(ident) CXX_RESULT(posix_##ident)
+#define CXX_DECLARE_RESULT_ERRNO_ARRAY(ident)                                                                                                                                                                                                                                                                                  \
+  CXX_DECLARE_RESULT_ARRAY(posix_##ident);                                                                                                                                                                                                                                                                                     \
+  CXX_DECLARE_RESULT_TO_ERRNO_ARRAY(posix_##ident)
+#define CXX_RESULT_ERRNO_ARRAY_FIRST_FAILURE(ident, results, count) CXX_RESULT_ARRAY_FIRST_FAILURE(posix_##ident, results, count)
+#define CXX_RESULT_ERRNO_ARRAY_STATUS_BITMAP(ident, bitmap, results, count) CXX_RESULT_ARRAY_STATUS_BITMAP(posix_##ident, bitmap, results, count)
+#define CXX_RESULT_ERRNO_ARRAY_TO_ERRNO(ident, errnos, results, count, other) cxx_result_posix_##ident##_to_errno((errnos), (results), (count), (other))
 
 struct cxx_status_code_system
 {
@@ -72,5 +212,11 @@ struct cxx_status_code_system
 };
 #define CXX_DECLARE_RESULT_SYSTEM(ident, R) CXX_DECLARE_RESULT(system_##ident, R, struct cxx_status_code_system)
 #define CXX_RESULT_SYSTEM(ident) CXX_RESULT(system_##ident)
+#define CXX_DECLARE_RESULT_SYSTEM_ARRAY(ident)                                                                                                                                                                                                                                                                                 \
+  CXX_DECLARE_RESULT_ARRAY(system_##ident);                                                                                                                                                                                                                                                                                    \
+  CXX_DECLARE_RESULT_TO_ERRNO_ARRAY(system_##ident)
+#define CXX_RESULT_SYSTEM_ARRAY_FIRST_FAILURE(ident, results, count) CXX_RESULT_ARRAY_FIRST_FAILURE(system_##ident, results, count)
+#define CXX_RESULT_SYSTEM_ARRAY_STATUS_BITMAP(ident, bitmap, results, count) CXX_RESULT_ARRAY_STATUS_BITMAP(system_##ident, bitmap, results, count)
+#define CXX_RESULT_SYSTEM_ARRAY_TO_ERRNO(ident, errnos, results, count, other) cxx_result_system_##ident##_to_errno((errnos), (results), (count), (other))
 
 #endif
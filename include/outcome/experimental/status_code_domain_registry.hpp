@@ -0,0 +1,193 @@
+/* A registry of status code domains for the experimental C API
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_STATUS_CODE_DOMAIN_REGISTRY_HPP
+#define OUTCOME_EXPERIMENTAL_STATUS_CODE_DOMAIN_REGISTRY_HPP
+
+#include "../interned_message.hpp"
+#include "result.h"
+
+#include "status-code/include/system_error2.hpp"
+
+#include <new>
+
+#ifndef OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS
+//! The number of distinct status code domains which can be looked up from C. Must be a power of two.
+#define OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS 64
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  namespace detail
+  {
+    static_assert((OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS & (OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS - 1)) == 0,
+                  "OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS must be a power of two");
+
+    struct status_code_domain_registry_entry
+    {
+      cxx_status_code_domain_info info;
+      std::string name;
+    };
+
+    /* An open addressed table of entries which are never freed, exactly as the
+    interned message table. The index of a domain is the slot it occupies.
+    */
+    inline std::atomic<status_code_domain_registry_entry *> *status_code_domain_registry() noexcept
+    {
+      static std::atomic<status_code_domain_registry_entry *> v[OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS];
+      return v;
+    }
+
+    /* Only errno domains have messages looked up from C. The value C passes is the erased
+    payload, which for other domains may be wider than intptr_t, or a pointer to storage
+    which is freed and reused for a different code, so a message cached by value would go
+    stale. The errno domains hold an int, and their messages never change.
+    */
+    inline const char *status_code_domain_message(const cxx_status_code_domain_info *info, intptr_t value) noexcept
+    {
+      if((info->flags & CXX_STATUS_CODE_DOMAIN_ERRNO) == 0)
+      {
+        return nullptr;
+      }
+      const auto *domain = static_cast<const SYSTEM_ERROR2_NAMESPACE::status_code_domain *>(info->domain);
+#ifdef __cpp_exceptions
+      try
+#endif
+      {
+        std::string fallback;
+        const std::string &ret = OUTCOME_V2_NAMESPACE::detail::intern_message(
+        domain, value,
+        [domain, value] {
+          auto msg = (*domain == SYSTEM_ERROR2_NAMESPACE::_generic_code_domain::get()) ?
+                     SYSTEM_ERROR2_NAMESPACE::generic_code(static_cast<SYSTEM_ERROR2_NAMESPACE::errc>(value)).message() :
+                     SYSTEM_ERROR2_NAMESPACE::posix_code(static_cast<int>(value)).message();
+          return std::string(msg.data(), msg.size());
+        },
+        fallback);
+        // A message which could not be interned has nowhere to live which C could borrow
+        return (&ret != &fallback) ? ret.c_str() : nullptr;
+      }
+#ifdef __cpp_exceptions
+      catch(...)
+      {
+        // C is told there is no message rather than the process terminating
+        return nullptr;
+      }
+#endif
+    }
+
+    // Returns a new entry for the domain, or null if memory could not be allocated
+    inline status_code_domain_registry_entry *make_status_code_domain_registry_entry(const SYSTEM_ERROR2_NAMESPACE::status_code_domain *domain) noexcept
+    {
+      auto *ret = new(std::nothrow) status_code_domain_registry_entry;
+      if(ret == nullptr)
+      {
+        return nullptr;
+      }
+#ifdef __cpp_exceptions
+      try
+#endif
+      {
+        auto name = domain->name();
+        ret->name.assign(name.data(), name.size());
+      }
+#ifdef __cpp_exceptions
+      catch(...)
+      {
+        delete ret;
+        return nullptr;
+      }
+#endif
+      ret->info.domain = domain;
+      ret->info.id = domain->id();
+      ret->info.name = ret->name.c_str();
+      ret->info.flags = (*domain == SYSTEM_ERROR2_NAMESPACE::_generic_code_domain::get() || *domain == SYSTEM_ERROR2_NAMESPACE::_posix_code_domain::get()) ? CXX_STATUS_CODE_DOMAIN_ERRNO : 0;
+      ret->info.message = status_code_domain_message;
+      return ret;
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline const cxx_status_code_domain_info *status_code_domain_lookup(const SYSTEM_ERROR2_NAMESPACE::status_code_domain *domain) noexcept
+  {
+    if(domain == nullptr)
+    {
+      return nullptr;
+    }
+    std::atomic<detail::status_code_domain_registry_entry *> *table = detail::status_code_domain_registry();
+    detail::status_code_domain_registry_entry *mine = nullptr;
+    size_t idx = static_cast<size_t>(domain->id());
+    for(size_t n = 0; n < OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS; n++, idx++)
+    {
+      std::atomic<detail::status_code_domain_registry_entry *> &slot = table[idx & (OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS - 1)];
+      detail::status_code_domain_registry_entry *e = slot.load(std::memory_order_acquire);
+      if(e == nullptr)
+      {
+        if(mine == nullptr)
+        {
+          mine = detail::make_status_code_domain_registry_entry(domain);
+          if(mine == nullptr)
+          {
+            return nullptr;
+          }
+        }
+        mine->info.index = static_cast<unsigned>(idx & (OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS - 1));
+        if(slot.compare_exchange_strong(e, mine, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return &mine->info;
+        }
+      }
+      // Domains compare equal by id, so each copy of a domain, such as one per shared library, shares one entry
+      if(*static_cast<const SYSTEM_ERROR2_NAMESPACE::status_code_domain *>(e->info.domain) == *domain)
+      {
+        delete mine;
+        return &e->info;
+      }
+    }
+    delete mine;
+    return nullptr;
+  }
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+/* Define this in exactly one translation unit of the shared library or executable
+before including this header, to define the C API.
+*/
+#ifdef OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_DEFINE_C_API
+#ifdef _WIN32
+extern "C" __declspec(dllexport) const struct cxx_status_code_domain_info *cxx_status_code_domain_lookup(const void *domain)
+#else
+extern "C" __attribute__((visibility("default"))) const struct cxx_status_code_domain_info *cxx_status_code_domain_lookup(const void *domain)
+#endif
+{
+  return OUTCOME_V2_NAMESPACE::experimental::status_code_domain_lookup(static_cast<const SYSTEM_ERROR2_NAMESPACE::status_code_domain *>(domain));
+}
+#endif
+
+#endif
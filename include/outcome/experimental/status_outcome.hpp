@@ -32,21 +32,161 @@ Distributed under the Boost Software License, Version 1.0.
 
 // Boost.Outcome #include "boost/exception_ptr.hpp"
 
-SYSTEM_ERROR2_NAMESPACE_BEGIN
-template <class DomainType> inline std::exception_ptr basic_outcome_failure_exception_from_error(const status_code<DomainType> &sc)
+#include <atomic>
+#include <new>
+
+#ifndef OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE
+/*! The number of exception ptrs cached per standard status code domain. Zero, the default, disables caching.
+When enabled, failures from status codes of the standard domains with values in `[0, OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE)`
+are given the same `status_error` instance each time, which is never freed. Nothing may then modify a caught `status_error`.
+*/
+#define OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE 0
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace trait
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class DomainType> struct status_code_throws_status_error
+  {
+    //! Specialise to true for your domain if its `_do_throw_exception()` throws `status_error<DomainType>(code)`
+    static constexpr bool value = false;
+  };
+  template <> struct status_code_throws_status_error<SYSTEM_ERROR2_NAMESPACE::_generic_code_domain>
+  {
+    static constexpr bool value = true;
+  };
+  template <> struct status_code_throws_status_error<SYSTEM_ERROR2_NAMESPACE::_posix_code_domain>
+  {
+    static constexpr bool value = true;
+  };
+#ifdef _WIN32
+  template <> struct status_code_throws_status_error<SYSTEM_ERROR2_NAMESPACE::_win32_code_domain>
+  {
+    static constexpr bool value = true;
+  };
+  template <> struct status_code_throws_status_error<SYSTEM_ERROR2_NAMESPACE::_nt_code_domain>
+  {
+    static constexpr bool value = true;
+  };
+#endif
+}  // namespace trait
+
+namespace detail
 {
-  (void) sc;
 #ifdef __cpp_exceptions
-  try
+  // The slow path, which works for any domain
+  template <class DomainType> inline std::exception_ptr status_error_ptr_by_throwing(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc)
+  {
+    try
+    {
+      sc.throw_exception();
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+  }
+
+  /* Only the standard domains are cached, as their singletons are stateless. Exception ptrs are
+  leaked heap allocations installed into their slot by whichever thread first makes one.
+  */
+  template <class DomainType,
+            bool = (OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE > 0) && (std::is_same<DomainType, SYSTEM_ERROR2_NAMESPACE::_generic_code_domain>::value ||
+                                                                     std::is_same<DomainType, SYSTEM_ERROR2_NAMESPACE::_posix_code_domain>::value)>
+  struct status_error_ptr_maker
+  {
+    static std::exception_ptr make(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc) { return std::make_exception_ptr(SYSTEM_ERROR2_NAMESPACE::status_error<DomainType>(sc)); }
+  };
+  template <class DomainType> struct status_error_ptr_maker<DomainType, true>
+  {
+    static std::atomic<std::exception_ptr *> *slots() noexcept
+    {
+      static std::atomic<std::exception_ptr *> v[(OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE > 0) ? OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE : 1];
+      return v;
+    }
+    static std::exception_ptr make(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc)
+    {
+      const auto idx = static_cast<unsigned long long>(sc.value());  // negative values wrap, and so are not cached
+      if(idx >= static_cast<unsigned long long>(OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE))
+      {
+        return status_error_ptr_maker<DomainType, false>::make(sc);
+      }
+      std::atomic<std::exception_ptr *> &slot = slots()[idx];
+      std::exception_ptr *p = slot.load(std::memory_order_acquire);
+      if(p == nullptr)
+      {
+        auto *np = new(std::nothrow) std::exception_ptr(status_error_ptr_maker<DomainType, false>::make(sc));
+        if(np == nullptr)
+        {
+          return status_error_ptr_maker<DomainType, false>::make(sc);
+        }
+        if(slot.compare_exchange_strong(p, np, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return *np;
+        }
+        delete np;  // another thread won
+      }
+      return *p;
+    }
+  };
+
+  template <class DomainType, typename std::enable_if<trait::status_code_throws_status_error<DomainType>::value, bool>::type = true>
+  inline std::exception_ptr status_error_ptr(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc)
   {
-    sc.throw_exception();
+    return status_error_ptr_maker<DomainType>::make(sc);
   }
-  catch(...)
+  template <class DomainType, typename std::enable_if<!trait::status_code_throws_status_error<DomainType>::value, bool>::type = true>
+  inline std::exception_ptr status_error_ptr(const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &sc)
   {
-    return std::current_exception();
+    return status_error_ptr_by_throwing(sc);
+  }
+  // Erased codes from a standard domain are converted back to their typed code, as the domain would before throwing
+  template <class ErasedType> inline std::exception_ptr status_error_ptr(const SYSTEM_ERROR2_NAMESPACE::status_code<SYSTEM_ERROR2_NAMESPACE::erased<ErasedType>> &sc)
+  {
+    if(!sc.empty())
+    {
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::_generic_code_domain::get())
+      {
+        return status_error_ptr(SYSTEM_ERROR2_NAMESPACE::generic_code(sc));
+      }
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::_posix_code_domain::get())
+      {
+        return status_error_ptr(SYSTEM_ERROR2_NAMESPACE::posix_code(sc));
+      }
+#ifdef _WIN32
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::_win32_code_domain::get())
+      {
+        return status_error_ptr(SYSTEM_ERROR2_NAMESPACE::win32_code(sc));
+      }
+      if(sc.domain() == SYSTEM_ERROR2_NAMESPACE::_nt_code_domain::get())
+      {
+        return status_error_ptr(SYSTEM_ERROR2_NAMESPACE::nt_code(sc));
+      }
+#endif
+    }
+    return status_error_ptr_by_throwing(sc);
   }
 #endif
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+/* Failures from the standard domains, and from domains with `trait::status_code_throws_status_error`,
+are converted into exception ptrs without throwing. Other domains are thrown and caught.
+*/
+template <class DomainType> inline std::exception_ptr basic_outcome_failure_exception_from_error(const status_code<DomainType> &sc)
+{
+  (void) sc;
+#ifdef __cpp_exceptions
+  return OUTCOME_V2_NAMESPACE::detail::status_error_ptr(sc);
+#else
   return {};
+#endif
 }
 SYSTEM_ERROR2_NAMESPACE_END
 
@@ -81,6 +221,7 @@ SIGNATURE NOT RECOGNISED
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
+          OUTCOME_TRACEPOINT(value_check_throw, &self);
           if(base::_has_exception(static_cast<Impl &&>(self)))
           {
             OUTCOME_V2_NAMESPACE::policy::detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>(base::_exception<T, status_code<DomainType>, E, status_code_throw>(static_cast<Impl &&>(self)));  // NOLINT
@@ -104,6 +104,7 @@ namespace experimental
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
+          OUTCOME_TRACEPOINT(value_check_throw, &self);
           if(base::_has_error(static_cast<Impl &&>(self)))
           {
 #ifdef __cpp_exceptions
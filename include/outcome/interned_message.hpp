@@ -0,0 +1,133 @@
+/* Interned error code messages
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_INTERNED_MESSAGE_HPP
+#define OUTCOME_INTERNED_MESSAGE_HPP
+
+#include "config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+#ifndef OUTCOME_INTERNED_MESSAGE_SLOTS
+//! The number of distinct (category, value) messages which can be interned. Must be a power of two.
+#define OUTCOME_INTERNED_MESSAGE_SLOTS 1024
+#endif
+#ifndef OUTCOME_INTERNED_MESSAGE_MAX_PROBES
+//! The number of slots searched for a message before it is formatted without being interned.
+#define OUTCOME_INTERNED_MESSAGE_MAX_PROBES 16
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  static_assert((OUTCOME_INTERNED_MESSAGE_SLOTS & (OUTCOME_INTERNED_MESSAGE_SLOTS - 1)) == 0, "OUTCOME_INTERNED_MESSAGE_SLOTS must be a power of two");
+  static_assert(OUTCOME_INTERNED_MESSAGE_MAX_PROBES > 0 && OUTCOME_INTERNED_MESSAGE_MAX_PROBES <= OUTCOME_INTERNED_MESSAGE_SLOTS, "OUTCOME_INTERNED_MESSAGE_MAX_PROBES must be between one and OUTCOME_INTERNED_MESSAGE_SLOTS");
+
+  /* Keyed on the address of the category or domain, plus the value, so that error
+  codes and status codes can share the table.
+  */
+  struct interned_message_entry
+  {
+    const void *key;
+    intptr_t value;
+    std::string message;
+  };
+
+  /* An open addressed table of entries which are never freed. A slot only ever goes
+  from null to an entry, so readers need nothing more than an acquire load. Inserters
+  format the message before trying to install it, and the loser of a race to install
+  the same key frees its entry and uses the winner's. Probing stops after
+  OUTCOME_INTERNED_MESSAGE_MAX_PROBES slots, so a crowded table costs a bounded search.
+  */
+  inline std::atomic<interned_message_entry *> *interned_messages() noexcept
+  {
+    static std::atomic<interned_message_entry *> v[OUTCOME_INTERNED_MESSAGE_SLOTS];
+    return v;
+  }
+
+  inline size_t interned_message_hash(const void *key, intptr_t value) noexcept
+  {
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) ^ (static_cast<uint64_t>(value) * 0x9E3779B97F4A7C15ULL);
+    h ^= h >> 29;
+    return static_cast<size_t>(h);
+  }
+
+  /* `make_message()` is only called if the message is not already interned. If there is no
+  room to intern it, the message is assigned to `fallback`, which the caller keeps, and
+  that is returned instead.
+  */
+  template <class F> inline const std::string &intern_message(const void *key, intptr_t value, F &&make_message, std::string &fallback)
+  {
+    std::atomic<interned_message_entry *> *table = interned_messages();
+    interned_message_entry *mine = nullptr;
+    size_t idx = interned_message_hash(key, value);
+    for(size_t n = 0; n < OUTCOME_INTERNED_MESSAGE_MAX_PROBES; n++, idx++)
+    {
+      std::atomic<interned_message_entry *> &slot = table[idx & (OUTCOME_INTERNED_MESSAGE_SLOTS - 1)];
+      interned_message_entry *e = slot.load(std::memory_order_acquire);
+      if(e == nullptr)
+      {
+        if(mine == nullptr)
+        {
+          mine = new interned_message_entry{key, value, make_message()};
+        }
+        if(slot.compare_exchange_strong(e, mine, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return mine->message;
+        }
+      }
+      if(e->key == key && e->value == value)
+      {
+        delete mine;
+        return e->message;
+      }
+    }
+    if(mine != nullptr)
+    {
+      fallback = static_cast<std::string &&>(mine->message);
+      delete mine;
+    }
+    else
+    {
+      fallback = make_message();
+    }
+    return fallback;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline const std::string &interned_message(const std::error_code &ec, std::string &fallback)
+{
+  return detail::intern_message(&ec.category(), ec.value(), [&ec] { return ec.message(); }, fallback);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
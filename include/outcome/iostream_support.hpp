@@ -25,6 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_IOSTREAM_SUPPORT_HPP
 #define OUTCOME_IOSTREAM_SUPPORT_HPP
 
+#include "interned_message.hpp"
 #include "outcome.hpp"
 
 #include <iostream>
@@ -96,10 +97,25 @@ namespace detail
     }
     return s;
   }
+  // Streams as " (message)", or as nothing for error types without a message
+  struct safe_message_t
+  {
+    bool has_message;
+    std::error_code ec;
+  };
+  inline std::ostream &operator<<(std::ostream &s, const safe_message_t &v)
+  {
+    if(v.has_message)
+    {
+      std::string fallback;
+      s << " (" << interned_message(v.ec, fallback) << ")";
+    }
+    return s;
+  }
   OUTCOME_TEMPLATE(class T)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<std::error_code, T>::value))
-  inline std::string safe_message(T && /*unused*/) { return {}; }
-  inline std::string safe_message(const std::error_code &ec) { return " (" + ec.message() + ")"; }
+  inline safe_message_t safe_message(T && /*unused*/) { return {false, {}}; }
+  inline safe_message_t safe_message(const std::error_code &ec) { return {true, ec}; }
 }  // namespace detail
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -0,0 +1,173 @@
+/* A thread confined exception ptr without atomic reference counting
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_LOCAL_EXCEPTION_PTR_HPP
+#define OUTCOME_LOCAL_EXCEPTION_PTR_HPP
+
+#include "std_outcome.hpp"
+
+#include <cstddef>
+#include <exception>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  local_exception_ptr. Potential doc page: NOT FOUND
+*/
+class local_exception_ptr
+{
+  /* The `std::exception_ptr` is held exactly once, by a block shared by all copies of
+  this handle. As the count is not atomic, copying and destroying handles costs no
+  more than copying and destroying a raw pointer, but all copies must stay on one thread.
+  */
+  struct _block
+  {
+    std::exception_ptr ep;
+    size_t refs;
+  };
+  _block *_p{nullptr};
+
+  void _release() noexcept
+  {
+    if(_p != nullptr && --_p->refs == 0)
+    {
+      delete _p;
+    }
+    _p = nullptr;
+  }
+
+public:
+  //! Default constructor, the null handle
+  constexpr local_exception_ptr() noexcept = default;
+  //! Constructs the null handle
+  constexpr local_exception_ptr(std::nullptr_t) noexcept {}  // NOLINT
+  //! Takes ownership of an exception ptr. Allocates unless `ep` is null.
+  local_exception_ptr(std::exception_ptr ep)  // NOLINT
+      : _p((ep != nullptr) ? new _block{static_cast<std::exception_ptr &&>(ep), 1} : nullptr)
+  {
+  }
+  //! Copy constructor. Does not touch an atomic.
+  local_exception_ptr(const local_exception_ptr &o) noexcept
+      : _p(o._p)
+  {
+    if(_p != nullptr)
+    {
+      ++_p->refs;
+    }
+  }
+  //! Move constructor
+  constexpr local_exception_ptr(local_exception_ptr &&o) noexcept
+      : _p(o._p)
+  {
+    o._p = nullptr;
+  }
+  //! Copy assignment
+  local_exception_ptr &operator=(const local_exception_ptr &o) noexcept
+  {
+    if(this != &o)
+    {
+      _release();
+      _p = o._p;
+      if(_p != nullptr)
+      {
+        ++_p->refs;
+      }
+    }
+    return *this;
+  }
+  //! Move assignment
+  local_exception_ptr &operator=(local_exception_ptr &&o) noexcept
+  {
+    if(this != &o)
+    {
+      _release();
+      _p = o._p;
+      o._p = nullptr;
+    }
+    return *this;
+  }
+  ~local_exception_ptr() { _release(); }
+
+  //! Converts into a `std::exception_ptr`, for rethrowing or handing to another thread
+  explicit operator std::exception_ptr() const noexcept { return (_p != nullptr) ? _p->ep : std::exception_ptr(); }
+  //! Converts into a `std::exception_ptr`, for rethrowing or handing to another thread
+  std::exception_ptr to_exception_ptr() const noexcept { return static_cast<std::exception_ptr>(*this); }
+
+  //! True if an exception is held
+  explicit operator bool() const noexcept { return _p != nullptr; }
+  //! The number of handles sharing the exception, zero for the null handle
+  size_t use_count() const noexcept { return (_p != nullptr) ? _p->refs : 0; }
+
+  //! Swaps with another handle
+  void swap(local_exception_ptr &o) noexcept
+  {
+    _block *t = _p;
+    _p = o._p;
+    o._p = t;
+  }
+
+  //! Handles compare equal if they refer to the same exception
+  friend bool operator==(const local_exception_ptr &a, const local_exception_ptr &b) noexcept { return a._p == b._p || (a._p != nullptr && b._p != nullptr && a._p->ep == b._p->ep); }
+  friend bool operator!=(const local_exception_ptr &a, const local_exception_ptr &b) noexcept { return !(a == b); }
+  friend bool operator==(const local_exception_ptr &a, std::nullptr_t) noexcept { return a._p == nullptr; }
+  friend bool operator!=(const local_exception_ptr &a, std::nullptr_t) noexcept { return a._p != nullptr; }
+  friend bool operator==(std::nullptr_t, const local_exception_ptr &a) noexcept { return a._p == nullptr; }
+  friend bool operator!=(std::nullptr_t, const local_exception_ptr &a) noexcept { return a._p != nullptr; }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline void swap(local_exception_ptr &a, local_exception_ptr &b) noexcept { a.swap(b); }
+
+// ADL discovered by `policy::exception_ptr()`, so the policies accept this as an exception ptr
+inline local_exception_ptr make_exception_ptr(local_exception_ptr v) { return v; }
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+[[noreturn]] inline void rethrow_exception(const local_exception_ptr &v) { std::rethrow_exception(static_cast<std::exception_ptr>(v)); }
+
+namespace trait
+{
+  namespace detail
+  {
+    // Shortcut this for lower build impact
+    template <> struct _is_exception_ptr_available<local_exception_ptr>
+    {
+      static constexpr bool value = true;
+      using type = local_exception_ptr;
+    };
+  }  // namespace detail
+
+  // local_exception_ptr is an error type, as std::exception_ptr is
+  template <> struct is_error_type<local_exception_ptr>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
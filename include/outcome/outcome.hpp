@@ -38,4 +38,11 @@ using outcome = std_outcome<R, S, P, NoValuePolicy>;
 
 OUTCOME_V2_NAMESPACE_END
 
+#if OUTCOME_EXTERN_TEMPLATES
+OUTCOME_V2_NAMESPACE_BEGIN
+// Instantiated by the outcome::extern_templates library
+OUTCOME_EXTERN_TEMPLATE_OUTCOME(int);
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #endif
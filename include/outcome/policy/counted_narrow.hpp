@@ -0,0 +1,172 @@
+/* Policies for result and outcome
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_POLICY_COUNTED_NARROW_HPP
+#define OUTCOME_POLICY_COUNTED_NARROW_HPP
+
+#include "throw_bad_result_access.hpp"
+
+#include <atomic>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifndef OUTCOME_COUNTED_NARROW_CHECKED
+/*! The default for the `Checked` parameter of `policy::counted_narrow`. When zero, bad observer
+calls are counted and recorded, otherwise they throw as `policy::throw_bad_result_access` does.
+This does not follow `NDEBUG`, so that it cannot differ between translation units by accident.
+*/
+#define OUTCOME_COUNTED_NARROW_CHECKED 0
+#endif
+#ifndef OUTCOME_COUNTED_NARROW_SITES
+//! The number of most recent bad observer call sites each thread remembers. Must be a power of two.
+#define OUTCOME_COUNTED_NARROW_SITES 16
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  counted_narrow_violation. Potential doc page: NOT FOUND
+*/
+  struct counted_narrow_violation
+  {
+    /*! The return address of the call which recorded the violation. Once the observer and
+    policy are inlined, as they are when optimising, this is within the function which called
+    the observer. Otherwise it is within the observer or the policy.
+    */
+    const void *call_site{nullptr};
+    //! Which observer was called: 'v' for value, 'e' for error, 'x' for exception
+    char observer{0};
+    //! The status bits of the result or outcome at the time
+    uint16_t status{0};
+  };
+
+  namespace detail
+  {
+    static_assert((OUTCOME_COUNTED_NARROW_SITES & (OUTCOME_COUNTED_NARROW_SITES - 1)) == 0, "OUTCOME_COUNTED_NARROW_SITES must be a power of two");
+
+    struct counted_narrow_record
+    {
+      uint64_t count{0};
+      counted_narrow_violation sites[OUTCOME_COUNTED_NARROW_SITES];
+    };
+    // Meyers' singleton returning the thread local violation record for this thread
+    inline counted_narrow_record &my_counted_narrow_record() noexcept
+    {
+      static OUTCOME_THREAD_LOCAL counted_narrow_record v;
+      return v;
+    }
+    inline std::atomic<uint64_t> &counted_narrow_total() noexcept
+    {
+      static std::atomic<uint64_t> v{0};
+      return v;
+    }
+
+    /* Never inlined, so the optimiser keeps this off the hot path, and the return address
+    identifies the code which called the observer, if the observer was inlined into it.
+    */
+#ifdef __GNUC__
+    __attribute__((cold))
+#endif
+    QUICKCPPLIB_NOINLINE inline void
+    counted_narrow_violated(char observer, uint16_t status) noexcept
+    {
+#ifdef _MSC_VER
+      const void *call_site = _ReturnAddress();
+#elif defined(__GNUC__)
+      const void *call_site = __builtin_return_address(0);
+#else
+      const void *call_site = nullptr;
+#endif
+      counted_narrow_record &r = my_counted_narrow_record();
+      r.sites[r.count & (OUTCOME_COUNTED_NARROW_SITES - 1)] = {call_site, observer, status};
+      r.count++;
+      counted_narrow_total().fetch_add(1, std::memory_order_relaxed);
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline uint64_t counted_narrow_violations() noexcept { return detail::my_counted_narrow_record().count; }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline uint64_t counted_narrow_total_violations() noexcept { return detail::counted_narrow_total().load(std::memory_order_relaxed); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class F> inline void for_each_counted_narrow_violation(F &&f)
+  {
+    const detail::counted_narrow_record &r = detail::my_counted_narrow_record();
+    const uint64_t first = (r.count > OUTCOME_COUNTED_NARROW_SITES) ? r.count - OUTCOME_COUNTED_NARROW_SITES : 0;
+    for(uint64_t n = first; n < r.count; n++)
+    {
+      f(r.sites[n & (OUTCOME_COUNTED_NARROW_SITES - 1)]);
+    }
+  }
+
+  /* Bad calls are recorded, then the observer proceeds as `all_narrow` would. Unlike
+  `all_narrow`, a bad call is not declared unreachable, else the optimiser would be free
+  to remove the recording along with it.
+  */
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  counted_narrow. Potential doc page: NOT FOUND
+*/
+  template <class EC, class EP, bool Checked = (OUTCOME_COUNTED_NARROW_CHECKED != 0)> struct counted_narrow : base
+  {
+    template <class Impl> static constexpr void wide_value_check(Impl &&self) noexcept
+    {
+      if(!base::_has_value(self))
+      {
+        detail::counted_narrow_violated('v', base::_status_bits(self));
+      }
+    }
+    template <class Impl> static constexpr void wide_error_check(Impl &&self) noexcept
+    {
+      if(!base::_has_error(self))
+      {
+        detail::counted_narrow_violated('e', base::_status_bits(self));
+      }
+    }
+    template <class Impl> static constexpr void wide_exception_check(Impl &&self) noexcept
+    {
+      if(!base::_has_exception(self))
+      {
+        detail::counted_narrow_violated('x', base::_status_bits(self));
+      }
+    }
+  };
+  // The checked edition, for debug builds
+  template <class EC, class EP> struct counted_narrow<EC, EP, true> : throw_bad_result_access<EC, EP>
+  {
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -40,6 +40,7 @@ type definition  error_code_throw_as_system_error. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        OUTCOME_TRACEPOINT(value_check_throw, &self);
         if(base::_has_exception(std::forward<Impl>(self)))
         {
           detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))};  // NOLINT
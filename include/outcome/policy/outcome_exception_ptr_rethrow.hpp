@@ -40,6 +40,7 @@ type definition  exception_ptr_rethrow. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        OUTCOME_TRACEPOINT(value_check_throw, &self);
         if(base::_has_exception(std::forward<Impl>(self)))
         {
           detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
@@ -0,0 +1,164 @@
+/* Policies for result and outcome
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_POLICY_REPORT_AND_CONTINUE_HPP
+#define OUTCOME_POLICY_REPORT_AND_CONTINUE_HPP
+
+#include "base.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  report_and_continue_failure. Potential doc page: NOT FOUND
+*/
+  struct report_and_continue_failure
+  {
+    /*! The return address of the call which made the report. Once the observer and policy
+    are inlined, as they are when optimising, this is within the function which called the
+    observer. Otherwise it is within the observer or the policy.
+    */
+    const void *call_site{nullptr};
+    //! The result or outcome whose observer was called
+    const void *object{nullptr};
+    //! The status bits of the result or outcome at the time
+    uint16_t status{0};
+    //! Which observer was called: 'v' for value, 'e' for error, 'x' for exception
+    char observer{0};
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  report_and_continue_handler. Potential doc page: NOT FOUND
+*/
+  template <class EC> using report_and_continue_handler = void (*)(const report_and_continue_failure &failure, const EC *error);
+
+  namespace detail
+  {
+    template <class EC> inline std::atomic<report_and_continue_handler<EC>> &report_and_continue_handler_storage() noexcept
+    {
+      static std::atomic<report_and_continue_handler<EC>> v{nullptr};
+      return v;
+    }
+
+    /* Never inlined, so the optimiser keeps this off the hot path, and the return address
+    identifies the code which called the observer, if the observer was inlined into it. Not noexcept, so a handler may throw
+    if exceptions are enabled.
+    */
+    template <class EC>
+#ifdef __GNUC__
+    __attribute__((cold))
+#endif
+    QUICKCPPLIB_NOINLINE inline void
+    report_and_continue_report(const void *object, char observer, uint16_t status, const EC *error)
+    {
+#ifdef _MSC_VER
+      const void *call_site = _ReturnAddress();
+#elif defined(__GNUC__)
+      const void *call_site = __builtin_return_address(0);
+#else
+      const void *call_site = nullptr;
+#endif
+      report_and_continue_handler<EC> handler = report_and_continue_handler_storage<EC>().load(std::memory_order_acquire);
+      if(handler == nullptr)
+      {
+        std::abort();
+      }
+      handler(report_and_continue_failure{call_site, object, status, observer}, error);
+    }
+
+    /* If the handler returned, the observer returns a default constructed value kept per thread
+    and per type, so the object observed is never modified. It is constructed afresh for each
+    report where it can be, in case an earlier caller modified it.
+    */
+    template <class T> inline void report_and_continue_reset(T &v, std::true_type /*is move assignable*/) { v = T{}; }
+    template <class T> inline void report_and_continue_reset(T & /*unused*/, std::false_type /*is move assignable*/) {}
+    template <class T> inline T &report_and_continue_default_value()
+    {
+      static OUTCOME_THREAD_LOCAL T v{};
+      report_and_continue_reset(v, std::is_move_assignable<T>());
+      return v;
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class EC> inline report_and_continue_handler<EC> set_report_and_continue_handler(report_and_continue_handler<EC> handler) noexcept
+  {
+    return detail::report_and_continue_handler_storage<EC>().exchange(handler, std::memory_order_acq_rel);
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  report_and_continue. Potential doc page: NOT FOUND
+*/
+  template <class EC, class EP> struct report_and_continue : base
+  {
+    /* If the handler returns, the object is left as it was, still reporting an error or
+    exception, and the observer returns a default constructed value from per thread storage
+    instead of the object's value. `.value()` therefore does not compile for value types
+    which cannot be default constructed.
+    */
+    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    {
+      if(!base::_has_value(self))
+      {
+        detail::report_and_continue_report<EC>(&self, 'v', base::_status_bits(self), base::_has_error(self) ? &base::_error(self) : nullptr);
+      }
+    }
+    template <class Impl> static constexpr auto &&wide_value(Impl &&self)
+    {
+      using value_ref = decltype(base::_value(static_cast<Impl &&>(self)));
+      using value_type = std::decay_t<value_ref>;
+      static_assert(std::is_default_constructible<value_type>::value, "policy::report_and_continue needs a default constructible value type to return from .value()");
+      return base::_has_value(self) ? base::_value(static_cast<Impl &&>(self)) : static_cast<value_ref>(detail::report_and_continue_default_value<value_type>());
+    }
+    // The error and exception are always constructed, default constructed if not set, so no repair is needed
+    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    {
+      if(!base::_has_error(self))
+      {
+        detail::report_and_continue_report<EC>(&self, 'e', base::_status_bits(self), nullptr);
+      }
+    }
+    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    {
+      if(!base::_has_exception(self))
+      {
+        detail::report_and_continue_report<EC>(&self, 'x', base::_status_bits(self), base::_has_error(self) ? &base::_error(self) : nullptr);
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -42,6 +42,7 @@ SIGNATURE NOT RECOGNISED
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        OUTCOME_TRACEPOINT(value_check_throw, &self);
         if(base::_has_error(std::forward<Impl>(self)))
         {
           // ADL
@@ -41,6 +41,7 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        OUTCOME_TRACEPOINT(value_check_throw, &self);
         OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
       }
     }
@@ -65,6 +66,7 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        OUTCOME_TRACEPOINT(value_check_throw, &self);
         if(base::_has_error(std::forward<Impl>(self)))
         {
           OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
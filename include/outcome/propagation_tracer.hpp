@@ -0,0 +1,174 @@
+/* Error propagation path tracer
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_PROPAGATION_TRACER_HPP
+#define OUTCOME_PROPAGATION_TRACER_HPP
+
+#include "outcome.hpp"
+#include "try.hpp"
+
+#if !OUTCOME_ENABLE_PROPAGATION_TRACER
+#error "Define OUTCOME_ENABLE_PROPAGATION_TRACER to 1 for all translation units to use the propagation tracer"
+#endif
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace propagation_tracer
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  site. Potential doc page: NOT FOUND
+*/
+  using site = OUTCOME_V2_NAMESPACE::detail::propagation_site;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  histogram. Potential doc page: NOT FOUND
+*/
+  struct histogram
+  {
+    //! Where failures were first propagated by TRY
+    site origin;
+    //! `hops[n]` is the number of failures which were propagated `n` times. The last bucket includes all longer paths.
+    std::vector<uint64_t> hops;
+
+    //! The number of failures from this origin
+    uint64_t total() const noexcept
+    {
+      uint64_t ret = 0;
+      for(auto i : hops)
+      {
+        ret += i;
+      }
+      return ret;
+    }
+    //! The mean number of propagations of failures from this origin
+    double mean() const noexcept
+    {
+      uint64_t count = 0, sum = 0;
+      for(size_t n = 0; n < hops.size(); n++)
+      {
+        count += hops[n];
+        sum += hops[n] * n;
+      }
+      return (count != 0) ? static_cast<double>(sum) / static_cast<double>(count) : 0;
+    }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T> inline std::vector<site> path_of(const T &r)
+  {
+    std::vector<site> ret;
+    const auto *rec = OUTCOME_V2_NAMESPACE::detail::my_propagation_arena().find(OUTCOME_V2_NAMESPACE::detail::propagation_key_of(OUTCOME_V2_NAMESPACE::hooks::spare_storage(&r)));
+    if(rec != nullptr)
+    {
+      ret.assign(rec->sites, rec->sites + std::min<uint32_t>(rec->hops, OUTCOME_PROPAGATION_TRACER_MAX_HOPS));
+    }
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline std::vector<histogram> histograms()
+  {
+    const auto &arena = OUTCOME_V2_NAMESPACE::detail::my_propagation_arena();
+    std::vector<histogram> ret;
+    auto add = [&ret](const site &origin, size_t bucket, uint64_t count) {
+      auto it = std::find_if(ret.begin(), ret.end(), [&](const histogram &h) { return h.origin == origin; });
+      if(it == ret.end())
+      {
+        ret.push_back(histogram{origin, std::vector<uint64_t>(OUTCOME_PROPAGATION_TRACER_MAX_HOPS + 1)});
+        it = ret.end() - 1;
+      }
+      it->hops[bucket] += count;
+    };
+    // Failures whose records were recycled
+    for(size_t n = 0; n < arena.finished_count; n++)
+    {
+      for(size_t b = 0; b <= OUTCOME_PROPAGATION_TRACER_MAX_HOPS; b++)
+      {
+        if(arena.finished[n].buckets[b] != 0)
+        {
+          add(arena.finished[n].origin, b, arena.finished[n].buckets[b]);
+        }
+      }
+    }
+    // Failures still tracked, which may yet travel further
+    for(const auto &r : arena.records)
+    {
+      if(r.tag != 0)
+      {
+        add(r.sites[0], std::min<uint32_t>(r.hops, OUTCOME_PROPAGATION_TRACER_MAX_HOPS), 1);
+      }
+    }
+    std::sort(ret.begin(), ret.end(), [](const histogram &a, const histogram &b) { return a.total() > b.total(); });
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void dump(std::ostream &s)
+  {
+    for(const auto &h : histograms())
+    {
+      s << h.origin.file << ":" << h.origin.line << " failures=" << h.total() << " mean hops=" << h.mean() << "\n";
+      for(size_t n = 1; n < h.hops.size(); n++)
+      {
+        if(h.hops[n] != 0)
+        {
+          s << "  " << n << ((n == h.hops.size() - 1) ? "+" : "") << " hops: " << h.hops[n] << "\n";
+        }
+      }
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void reset() noexcept
+  {
+    auto &arena = OUTCOME_V2_NAMESPACE::detail::my_propagation_arena();
+    for(auto &r : arena.records)
+    {
+      r.tag = 0;
+      r.hops = 0;
+    }
+    arena.finished_count = 0;
+    arena.finished_dropped = 0;
+    arena.pending = 0;
+  }
+}  // namespace propagation_tracer
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
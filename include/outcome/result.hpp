@@ -47,4 +47,17 @@ template <class R, class S = std::error_code> using checked = result<R, S, polic
 
 OUTCOME_V2_NAMESPACE_END
 
+#if OUTCOME_EXTERN_TEMPLATES
+#include "detail/extern_templates.hpp"
+
+#include <string>
+
+OUTCOME_V2_NAMESPACE_BEGIN
+// Instantiated by the outcome::extern_templates library
+OUTCOME_EXTERN_TEMPLATE_RESULT(void);
+OUTCOME_EXTERN_TEMPLATE_RESULT(int);
+OUTCOME_EXTERN_TEMPLATE_RESULT(std::string);
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #endif
@@ -0,0 +1,281 @@
+/* Sampled backtrace capture for errored results
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SAMPLED_BACKTRACE_HPP
+#define OUTCOME_SAMPLED_BACKTRACE_HPP
+
+#include "detail/observed_error_code.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef __ANDROID__
+#define OUTCOME_DISABLE_EXECINFO
+#endif
+
+#ifndef OUTCOME_DISABLE_EXECINFO
+#ifdef _WIN32
+#include "quickcpplib/execinfo_win64.h"
+#else
+#include <execinfo.h>
+#endif
+#endif  // OUTCOME_DISABLE_EXECINFO
+
+#ifndef OUTCOME_SAMPLED_BACKTRACE_SLOTS
+//! The number of captured backtraces each thread keeps before the oldest is overwritten. Must be a power of two.
+#define OUTCOME_SAMPLED_BACKTRACE_SLOTS 16
+#endif
+#ifndef OUTCOME_SAMPLED_BACKTRACE_DEPTH
+//! The maximum number of return addresses captured per backtrace.
+#define OUTCOME_SAMPLED_BACKTRACE_DEPTH 32
+#endif
+#ifndef OUTCOME_SAMPLED_BACKTRACE_DEFAULT_RATE
+//! By default one in this many errored constructions per thread captures a backtrace. Zero disables capture.
+#define OUTCOME_SAMPLED_BACKTRACE_DEFAULT_RATE 64
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace sampled_backtrace
+{
+  namespace detail
+  {
+    static_assert((OUTCOME_SAMPLED_BACKTRACE_SLOTS & (OUTCOME_SAMPLED_BACKTRACE_SLOTS - 1)) == 0, "OUTCOME_SAMPLED_BACKTRACE_SLOTS must be a power of two");
+
+    /* Tags live in the bits of spare storage above those owned by the propagation tracer,
+    which are none unless OUTCOME_ENABLE_PROPAGATION_TRACER is defined to 1.
+    */
+    static constexpr unsigned tag_shift = OUTCOME_PROPAGATION_TRACER_SPARE_STORAGE_BITS;
+    static constexpr uint16_t max_tag = static_cast<uint16_t>(0xffffU >> tag_shift);
+    static_assert(OUTCOME_SAMPLED_BACKTRACE_SLOTS <= max_tag, "OUTCOME_SAMPLED_BACKTRACE_SLOTS must fit into the spare storage left by the propagation tracer");
+    constexpr inline uint16_t tag_of(uint16_t spare_storage) noexcept { return static_cast<uint16_t>(spare_storage >> tag_shift); }
+    constexpr inline uint16_t with_tag(uint16_t spare_storage, uint16_t tag) noexcept
+    {
+      return static_cast<uint16_t>((spare_storage & ((1U << tag_shift) - 1)) | (static_cast<unsigned>(tag) << tag_shift));
+    }
+
+    inline std::atomic<uint32_t> &sample_rate() noexcept
+    {
+      static std::atomic<uint32_t> v{OUTCOME_SAMPLED_BACKTRACE_DEFAULT_RATE};
+      return v;
+    }
+
+    /* A slot is only ever written by its owning thread. The tag is recorded into the
+    spare storage of the captured result, so a stale tag whose slot has since been
+    reused is detected by the tag no longer matching.
+    */
+    struct slot
+    {
+      uint16_t tag{0};
+      uint16_t items{0};
+      void *frames[OUTCOME_SAMPLED_BACKTRACE_DEPTH];
+    };
+
+    struct ring
+    {
+      slot slots[OUTCOME_SAMPLED_BACKTRACE_SLOTS];
+      uint16_t last_tag{0};    // zero is never handed out, it means "no backtrace"
+      uint32_t countdown{0};  // errored constructions until the next capture
+
+      // Returns true if this errored construction is to be sampled
+      bool should_sample() noexcept
+      {
+        const uint32_t rate = sample_rate().load(std::memory_order_relaxed);
+        if(rate == 0)
+        {
+          return false;
+        }
+        if(countdown == 0 || countdown > rate)
+        {
+          countdown = rate;
+        }
+        return --countdown == 0;
+      }
+
+      slot &claim() noexcept
+      {
+        last_tag = (last_tag == max_tag) ? 1 : static_cast<uint16_t>(last_tag + 1);
+        slot &s = slots[last_tag & (OUTCOME_SAMPLED_BACKTRACE_SLOTS - 1)];
+        s.tag = last_tag;
+        return s;
+      }
+
+      const slot *find(uint16_t tag) const noexcept
+      {
+        if(tag == 0)
+        {
+          return nullptr;
+        }
+        const slot &s = slots[tag & (OUTCOME_SAMPLED_BACKTRACE_SLOTS - 1)];
+        return (s.tag == tag) ? &s : nullptr;
+      }
+    };
+
+    // Meyers' singleton returning the thread local backtrace ring for this thread
+    inline ring &my_ring() noexcept
+    {
+      static OUTCOME_THREAD_LOCAL ring v;
+      return v;
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void set_sample_rate(uint32_t one_in_n) noexcept { detail::sample_rate().store(one_in_n, std::memory_order_relaxed); }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline uint32_t sample_rate() noexcept { return detail::sample_rate().load(std::memory_order_relaxed); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  trace. Potential doc page: NOT FOUND
+*/
+  class trace
+  {
+    std::vector<void *> _frames;
+
+  public:
+    trace() = default;
+    explicit trace(std::vector<void *> frames)
+        : _frames(static_cast<std::vector<void *> &&>(frames))
+    {
+    }
+
+    //! True if a backtrace was found
+    explicit operator bool() const noexcept { return !_frames.empty(); }
+    //! The raw return addresses, innermost first
+    const std::vector<void *> &frames() const noexcept { return _frames; }
+
+    //! Symbolise the return addresses. This is slow, and is only done when called.
+    std::vector<std::string> symbols() const
+    {
+      std::vector<std::string> ret;
+#ifndef OUTCOME_DISABLE_EXECINFO
+      struct unsymbols  // RAII cleaner for symbols
+      {
+        char **_{nullptr};
+        ~unsymbols() { ::free(_); }  // NOLINT
+      } syms{::backtrace_symbols(_frames.data(), static_cast<int>(_frames.size()))};
+      if(syms._ != nullptr)
+      {
+        ret.reserve(_frames.size());
+        for(size_t n = 0; n < _frames.size(); n++)
+        {
+          ret.emplace_back(syms._[n]);
+        }
+      }
+#endif
+      return ret;
+    }
+    //! The symbolised backtrace as a single string, one frame per line
+    std::string to_string() const
+    {
+      std::string ret;
+      for(const auto &i : symbols())
+      {
+        ret.append(i);
+        ret.push_back('\n');
+      }
+      return ret;
+    }
+  };
+
+  namespace detail
+  {
+    // Captures a backtrace if this errored construction is sampled, recording its tag into the spare storage value
+    inline void capture(uint16_t &spare_storage) noexcept
+    {
+#ifndef OUTCOME_DISABLE_EXECINFO
+      ring &r = my_ring();
+      if(!r.should_sample())
+      {
+        return;
+      }
+      slot &s = r.claim();
+      const int items = ::backtrace(s.frames, OUTCOME_SAMPLED_BACKTRACE_DEPTH);
+      s.items = static_cast<uint16_t>((items > 0) ? items : 0);
+      spare_storage = with_tag(spare_storage, s.tag);
+#else
+      (void) spare_storage;
+#endif
+    }
+    inline void observe(const std::error_code & /*unused*/, uint16_t &spare_storage) noexcept { capture(spare_storage); }
+    static const OUTCOME_V2_NAMESPACE::detail::observed::observer_registration registration(observe);
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T> inline void capture_if_errored(T *res) noexcept
+  {
+    if(res->has_error())
+    {
+      uint16_t spare = OUTCOME_V2_NAMESPACE::hooks::spare_storage(res);
+      detail::capture(spare);
+      OUTCOME_V2_NAMESPACE::hooks::set_spare_storage(res, spare);
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T> inline trace backtrace_of(const T &res)
+  {
+    const detail::slot *s = detail::my_ring().find(detail::tag_of(OUTCOME_V2_NAMESPACE::hooks::spare_storage(&res)));
+    if(s == nullptr)
+    {
+      return {};
+    }
+    return trace(std::vector<void *>(s->frames, s->frames + s->items));
+  }
+
+  /* `sampled_backtrace::result<T>` and `sampled_backtrace::outcome<T>` use the error code bridge
+  shared with `<outcome/telemetry.hpp>`, so both features observe the same result types when
+  both are included. Otherwise call `capture_if_errored()` from your own hooks. Backtraces
+  are kept by the thread which constructed the result, and can only be retrieved from that
+  thread.
+  */
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  error_code. Potential doc page: NOT FOUND
+*/
+  using error_code = OUTCOME_V2_NAMESPACE::detail::observed::error_code;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R> using result = OUTCOME_V2_NAMESPACE::detail::observed::result<R>;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R> using outcome = OUTCOME_V2_NAMESPACE::detail::observed::outcome<R>;
+}  // namespace sampled_backtrace
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
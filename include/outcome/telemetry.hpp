@@ -0,0 +1,359 @@
+/* Lock-free failure telemetry built on the construction hooks
+(C) 2026 Outcome contributors
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TELEMETRY_HPP
+#define OUTCOME_TELEMETRY_HPP
+
+#include "detail/observed_error_code.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+#ifndef OUTCOME_TELEMETRY_SLOTS
+//! The number of distinct (category, value) pairs each thread can count before spilling into the overflow counter. Must be a power of two.
+#define OUTCOME_TELEMETRY_SLOTS 64
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace telemetry
+{
+  namespace detail
+  {
+    static_assert((OUTCOME_TELEMETRY_SLOTS & (OUTCOME_TELEMETRY_SLOTS - 1)) == 0, "OUTCOME_TELEMETRY_SLOTS must be a power of two");
+    static constexpr size_t cache_line_size = 64;
+
+    /* Only the owning thread ever writes a slot, so counts are bumped with a relaxed
+    load and store rather than a locked read-modify-write. The category pointer is
+    published last with release semantics, so a reader seeing it non-null also sees
+    the value it keys.
+    */
+    struct counter_slot
+    {
+      std::atomic<const std::error_category *> category{nullptr};
+      std::atomic<int> value{0};
+      std::atomic<uint64_t> count{0};
+    };
+
+    // Each thread's block starts on its own cache line so owners never share lines with one another
+    struct alignas(cache_line_size) thread_counters
+    {
+      counter_slot slots[OUTCOME_TELEMETRY_SLOTS];
+      std::atomic<uint64_t> overflow{0};
+      std::atomic<bool> in_use{true};
+      thread_counters *next{nullptr};
+
+      static void bump(std::atomic<uint64_t> &c) noexcept { c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+      void record(const std::error_category *cat, int v) noexcept
+      {
+        // Cheap mix of the category address and the value
+        size_t h = (reinterpret_cast<uintptr_t>(cat) >> 4U) ^ (static_cast<size_t>(static_cast<unsigned>(v)) * 0x9e3779b1U);
+        for(size_t n = 0; n < OUTCOME_TELEMETRY_SLOTS; n++)
+        {
+          counter_slot &s = slots[(h + n) & (OUTCOME_TELEMETRY_SLOTS - 1)];
+          const std::error_category *c = s.category.load(std::memory_order_relaxed);
+          if(c == nullptr)
+          {
+            s.value.store(v, std::memory_order_relaxed);
+            s.category.store(cat, std::memory_order_release);
+            bump(s.count);
+            return;
+          }
+          if(c == cat && s.value.load(std::memory_order_relaxed) == v)
+          {
+            bump(s.count);
+            return;
+          }
+        }
+        bump(overflow);
+      }
+    };
+
+    // Global intrusive list of every thread block ever created. Blocks are never freed, only recycled.
+    inline std::atomic<thread_counters *> &all_thread_counters() noexcept
+    {
+      static std::atomic<thread_counters *> v{nullptr};
+      return v;
+    }
+    // Errors which could not be recorded because a thread block could not be allocated
+    inline std::atomic<uint64_t> &unallocated_overflow() noexcept
+    {
+      static std::atomic<uint64_t> v{0};
+      return v;
+    }
+
+    inline thread_counters *claim_thread_counters() noexcept
+    {
+      // Reuse the block of an exited thread if there is one, its counts remain part of the totals
+      for(thread_counters *i = all_thread_counters().load(std::memory_order_acquire); i != nullptr; i = i->next)
+      {
+        bool expected = false;
+        if(!i->in_use.load(std::memory_order_relaxed) && i->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+          return i;
+        }
+      }
+      auto *ret = new(std::nothrow) thread_counters;
+      if(ret == nullptr)
+      {
+        return nullptr;
+      }
+      ret->next = all_thread_counters().load(std::memory_order_relaxed);
+      while(!all_thread_counters().compare_exchange_weak(ret->next, ret, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+      return ret;
+    }
+
+    struct thread_counters_holder
+    {
+      thread_counters *p{nullptr};
+      thread_counters_holder() = default;
+      thread_counters_holder(const thread_counters_holder &) = delete;
+      thread_counters_holder &operator=(const thread_counters_holder &) = delete;
+      ~thread_counters_holder()
+      {
+        if(p != nullptr)
+        {
+          p->in_use.store(false, std::memory_order_release);
+        }
+      }
+    };
+
+    // Meyers' singleton returning the thread local counter block for this thread
+    inline thread_counters *my_thread_counters() noexcept
+    {
+      static OUTCOME_THREAD_LOCAL thread_counters_holder v;
+      if(v.p == nullptr)
+      {
+        v.p = claim_thread_counters();
+      }
+      return v.p;
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void record(const std::error_category &category, int value) noexcept
+  {
+    detail::thread_counters *tc = detail::my_thread_counters();
+    if(tc == nullptr)
+    {
+      detail::unallocated_overflow().fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    tc->record(&category, value);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void record(const std::error_code &ec) noexcept
+  {
+    if(ec)
+    {
+      record(ec.category(), ec.value());
+    }
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T> inline void record_if_errored(const T *res) noexcept
+  {
+    if(res->has_error())
+    {
+      record(OUTCOME_V2_NAMESPACE::policy::error_code(res->assume_error()));
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  entry. Potential doc page: NOT FOUND
+*/
+  struct entry
+  {
+    const std::error_category *category{nullptr};
+    int value{0};
+    //! Errored constructions since the program began
+    uint64_t count{0};
+    //! Errored constructions per second since the previous snapshot, zero if there was none
+    double rate{0};
+
+    std::error_code code() const noexcept { return {value, *category}; }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  snapshot. Potential doc page: NOT FOUND
+*/
+  class snapshot
+  {
+    friend inline snapshot take_snapshot(const snapshot *previous);
+
+    std::chrono::steady_clock::time_point _when;
+    std::vector<entry> _entries;  // sorted by descending count
+    uint64_t _total{0}, _dropped{0};
+
+  public:
+    snapshot() = default;
+
+    //! When the snapshot was taken
+    std::chrono::steady_clock::time_point when() const noexcept { return _when; }
+    //! Total errored constructions counted, including those dropped
+    uint64_t total() const noexcept { return _total; }
+    //! Errored constructions counted without their (category, value) because a thread's table was full
+    uint64_t dropped() const noexcept { return _dropped; }
+    //! All counted codes, most frequent first
+    const std::vector<entry> &entries() const noexcept { return _entries; }
+    //! The `n` most frequent codes
+    std::vector<entry> top(size_t n) const { return {_entries.begin(), _entries.begin() + static_cast<ptrdiff_t>(std::min(n, _entries.size()))}; }
+    //! The count for a specific code in this snapshot
+    uint64_t count(const std::error_code &ec) const noexcept
+    {
+      for(const auto &i : _entries)
+      {
+        if(i.category == &ec.category() && i.value == ec.value())
+        {
+          return i.count;
+        }
+      }
+      return 0;
+    }
+
+    //! Write the `n` most frequent codes and their rates to `s`, one per line
+    void dump(std::ostream &s, size_t n = 10) const
+    {
+      s << "Outcome telemetry: " << _total << " errored constructions, " << _dropped << " unclassified\n";
+      for(const auto &i : top(n))
+      {
+        s << "  " << i.category->name() << ":" << i.value << " (" << i.category->message(i.value) << ") count=" << i.count << " rate=" << i.rate << "/sec\n";
+      }
+    }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline snapshot take_snapshot(const snapshot *previous = nullptr)
+  {
+    snapshot ret;
+    ret._when = std::chrono::steady_clock::now();
+    ret._dropped = detail::unallocated_overflow().load(std::memory_order_relaxed);
+    for(detail::thread_counters *i = detail::all_thread_counters().load(std::memory_order_acquire); i != nullptr; i = i->next)
+    {
+      ret._dropped += i->overflow.load(std::memory_order_relaxed);
+      for(auto &s : i->slots)
+      {
+        const std::error_category *c = s.category.load(std::memory_order_acquire);
+        if(c == nullptr)
+        {
+          continue;
+        }
+        const int v = s.value.load(std::memory_order_relaxed);
+        const uint64_t count = s.count.load(std::memory_order_relaxed);
+        auto it = std::find_if(ret._entries.begin(), ret._entries.end(), [&](const entry &e) { return e.category == c && e.value == v; });
+        if(it == ret._entries.end())
+        {
+          ret._entries.push_back(entry{c, v, count, 0});
+        }
+        else
+        {
+          it->count += count;
+        }
+      }
+    }
+    ret._total = ret._dropped;
+    for(const auto &i : ret._entries)
+    {
+      ret._total += i.count;
+    }
+    std::sort(ret._entries.begin(), ret._entries.end(), [](const entry &a, const entry &b) { return a.count > b.count; });
+    if(previous != nullptr)
+    {
+      const double secs = std::chrono::duration<double>(ret._when - previous->_when).count();
+      if(secs > 0)
+      {
+        for(auto &i : ret._entries)
+        {
+          i.rate = static_cast<double>(i.count - previous->count(i.code())) / secs;
+        }
+      }
+    }
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  collector. Potential doc page: NOT FOUND
+*/
+  class collector
+  {
+    snapshot _last;
+    bool _have_last{false};
+
+  public:
+    //! Merge all thread counters into a new global snapshot, with rates relative to the previous call
+    const snapshot &collect()
+    {
+      snapshot s = take_snapshot(_have_last ? &_last : nullptr);
+      _last = static_cast<snapshot &&>(s);
+      _have_last = true;
+      return _last;
+    }
+    //! The most recently collected snapshot
+    const snapshot &last() const noexcept { return _last; }
+  };
+
+  namespace detail
+  {
+    inline void observe(const std::error_code &ec, uint16_t & /*unused*/) noexcept { record(ec); }
+    static const OUTCOME_V2_NAMESPACE::detail::observed::observer_registration registration(observe);
+  }  // namespace detail
+
+  /* `telemetry::result<T>` and `telemetry::outcome<T>` use the error code bridge shared with
+  `<outcome/sampled_backtrace.hpp>`, so both features observe the same result types when
+  both are included. Otherwise call `record_if_errored()` from your own hooks.
+  */
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  error_code. Potential doc page: NOT FOUND
+*/
+  using error_code = OUTCOME_V2_NAMESPACE::detail::observed::error_code;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R> using result = OUTCOME_V2_NAMESPACE::detail::observed::result<R>;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R> using outcome = OUTCOME_V2_NAMESPACE::detail::observed::outcome<R>;
+}  // namespace telemetry
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
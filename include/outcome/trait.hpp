@@ -61,6 +61,15 @@ type definition  is_error_type_enum. Potential doc page: NOT FOUND
     static constexpr bool value = false;
   };
 
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  is_bytewise_comparable. Potential doc page: NOT FOUND
+*/
+  template <class T> struct is_bytewise_comparable
+  {
+    //! Specialise to true for types without padding whose `operator==` compares all their bytes, so results may compare them with `memcmp()`
+    static constexpr bool value = false;
+  };
+
   namespace detail
   {
     template <class T> using devoid = OUTCOME_V2_NAMESPACE::detail::devoid<T>;
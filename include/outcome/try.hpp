@@ -27,6 +27,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "success_failure.hpp"
 
+#if OUTCOME_ENABLE_PROPAGATION_TRACER
+#include "basic_result.hpp"
+#endif
+
 OUTCOME_V2_NAMESPACE_BEGIN
 
 namespace detail
@@ -88,6 +92,7 @@ OUTCOME_TEMPLATE(class T)
 OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::has_as_failure<T>(5)))
 constexpr inline decltype(auto) try_operation_return_as(T &&v, detail::as_failure_overload = {})
 {
+  OUTCOME_TRACEPOINT(try_return, &v);
   return static_cast<T &&>(v).as_failure();
 }
 /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -97,6 +102,7 @@ OUTCOME_TEMPLATE(class T)
 OUTCOME_TREQUIRES(OUTCOME_TPRED(!detail::has_as_failure<T>(5) && detail::has_assume_error<T>(5)))
 constexpr inline decltype(auto) try_operation_return_as(T &&v, detail::assume_error_overload = {})
 {
+  OUTCOME_TRACEPOINT(try_return, &v);
   return failure(static_cast<T &&>(v).assume_error());
 }
 /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -106,9 +112,27 @@ OUTCOME_TEMPLATE(class T)
 OUTCOME_TREQUIRES(OUTCOME_TPRED(!detail::has_as_failure<T>(5) && !detail::has_assume_error<T>(5) && detail::has_error<T>(5)))
 constexpr inline decltype(auto) try_operation_return_as(T &&v, detail::error_overload = {})
 {
+  OUTCOME_TRACEPOINT(try_return, &v);
   return failure(static_cast<T &&>(v).error());
 }
 
+#if OUTCOME_ENABLE_PROPAGATION_TRACER
+namespace detail
+{
+  template <class R, class S, class NoValuePolicy> inline uint16_t propagation_key(const basic_result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    return propagation_key_of(hooks::spare_storage(r));
+  }
+  inline uint16_t propagation_key(const void * /*unused*/) noexcept { return 0; }
+  // Called by the TRY macros just before a failure is propagated. Keep the returned scope alive until the return statement ends.
+  template <class T> inline propagation_scope try_propagation_hop(const T &v, const char *file, unsigned line) noexcept
+  {
+    propagation_tracer_hop(propagation_key(&v), file, line);
+    return {};
+  }
+}  // namespace detail
+#endif
+
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
@@ -158,20 +182,28 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+#if OUTCOME_ENABLE_PROPAGATION_TRACER
+#define OUTCOME_TRY_RETURN_AS(unique)                                                                                                                          \
+  ((void) OUTCOME_V2_NAMESPACE::detail::try_propagation_hop(unique, __FILE__, __LINE__),                                                                       \
+   OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique)))
+#else
+#define OUTCOME_TRY_RETURN_AS(unique) OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+#endif
+
 // Use if(!expr); else as some compilers assume else clauses are always unlikely
 #define OUTCOME_TRYV2_SUCCESS_LIKELY(unique, ...)                                                                                                              \
   auto &&unique = (__VA_ARGS__);                                                                                                                               \
   if(OUTCOME_TRY_LIKELY(OUTCOME_V2_NAMESPACE::try_operation_has_value(unique)))                                                                                \
     ;                                                                                                                                                          \
   else                                                                                                                                                         \
-    return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+    return OUTCOME_TRY_RETURN_AS(unique)
 #define OUTCOME_TRY2_SUCCESS_LIKELY(unique, v, ...)                                                                                                            \
   OUTCOME_TRYV2_SUCCESS_LIKELY(unique, __VA_ARGS__);                                                                                                           \
   auto &&v = OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
 #define OUTCOME_TRYV2_FAILURE_LIKELY(unique, ...)                                                                                                              \
   auto &&unique = (__VA_ARGS__);                                                                                                                               \
   if(OUTCOME_TRY_LIKELY(!OUTCOME_V2_NAMESPACE::try_operation_has_value(unique)))                                                                               \
-  return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+  return OUTCOME_TRY_RETURN_AS(unique)
 #define OUTCOME_TRY2_FAILURE_LIKELY(unique, v, ...)                                                                                                            \
   OUTCOME_TRYV2_FAILURE_LIKELY(unique, __VA_ARGS__);                                                                                                           \
   auto &&v = OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
@@ -181,14 +213,14 @@ OUTCOME_V2_NAMESPACE_END
   if(OUTCOME_TRY_LIKELY(OUTCOME_V2_NAMESPACE::try_operation_has_value(unique)))                                                                                \
     ;                                                                                                                                                          \
   else                                                                                                                                                         \
-    co_return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+    co_return OUTCOME_TRY_RETURN_AS(unique)
 #define OUTCOME_CO_TRY2_SUCCESS_LIKELY(unique, v, ...)                                                                                                         \
   OUTCOME_CO_TRYV2_SUCCESS_LIKELY(unique, __VA_ARGS__);                                                                                                        \
   auto &&v = OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
 #define OUTCOME_CO_TRYV2_FAILURE_LIKELY(unique, ...)                                                                                                           \
   auto &&unique = (__VA_ARGS__);                                                                                                                               \
   if(OUTCOME_TRY_LIKELY(!OUTCOME_V2_NAMESPACE::try_operation_has_value(unique)))                                                                               \
-  co_return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+  co_return OUTCOME_TRY_RETURN_AS(unique)
 #define OUTCOME_CO_TRY2_FAILURE_LIKELY(unique, v, ...)                                                                                                         \
   OUTCOME_CO_TRYV2_FAILURE_LIKELY(unique, __VA_ARGS__);                                                                                                        \
   auto &&v = OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
@@ -222,7 +254,7 @@ SIGNATURE NOT RECOGNISED
     if(OUTCOME_TRY_LIKELY(OUTCOME_V2_NAMESPACE::try_operation_has_value(res)))                                                                                 \
       ;                                                                                                                                                        \
     else                                                                                                                                                       \
-      return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(res) &&>(res));                                                                \
+      return OUTCOME_TRY_RETURN_AS(res);                                                                                                                       \
     OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(res) &&>(res));                                                                     \
   })
 
@@ -235,7 +267,7 @@ SIGNATURE NOT RECOGNISED
     if(OUTCOME_TRY_LIKELY(OUTCOME_V2_NAMESPACE::try_operation_has_value(res)))                                                                                 \
       ;                                                                                                                                                        \
     else                                                                                                                                                       \
-      co_return OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(res) &&>(res));                                                             \
+      co_return OUTCOME_TRY_RETURN_AS(res);                                                                                                                    \
     OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(res) &&>(res));                                                                     \
   })
 #endif
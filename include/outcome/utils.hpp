@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_UTILS_HPP
 
 #include "config.hpp"
+#include "detail/exception_classifier.hpp"
 
 #include <exception>
 #include <string>
@@ -34,6 +35,15 @@ Distributed under the Boost Software License, Version 1.0.
 OUTCOME_V2_NAMESPACE_BEGIN
 
 #ifdef __cpp_exceptions
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E> inline bool register_exception_to_error(std::error_code ec) noexcept { return detail::register_exception_mapping(detail::make_exception_mapping<E>(ec)); }
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E> inline bool register_exception_to_error(std::error_code (*f)(const E &)) noexcept { return detail::register_exception_mapping(detail::make_exception_mapping<E>({}, f)); }
+
 /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
@@ -43,6 +53,18 @@ inline std::error_code error_from_exception(std::exception_ptr &&ep = std::curre
   {
     return {};
   }
+  // Types seen before are classified without rethrowing
+  std::error_code ec;
+  switch(detail::classify_exception(ep, ec))
+  {
+  case detail::exception_classification::matched:
+    ep = std::exception_ptr();
+    return ec;
+  case detail::exception_classification::unmatched:
+    return not_matched;
+  case detail::exception_classification::unknown:
+    break;
+  }
   try
   {
     std::rethrow_exception(ep);
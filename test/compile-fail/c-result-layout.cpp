@@ -0,0 +1,41 @@
+/* clang-format off
+C and C\+\+ result types differ in layout
+clang-format on
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/result.h"
+#include "../../include/outcome/experimental/status_result.hpp"
+
+// The same size and alignment as the C++ type, but with the flags and error swapped
+struct cxx_result_reordered
+{
+  long value;
+  struct cxx_status_code_posix error;
+  unsigned flags;
+};
+// Must not be possible to pass a C result type with members in a different order
+CXX_RESULT_STATIC_ASSERT_LAYOUT(reordered, OUTCOME_V2_NAMESPACE::experimental::status_result<long, SYSTEM_ERROR2_NAMESPACE::posix_code>);
+
+int main()
+{
+  return 0;
+}
@@ -6,6 +6,7 @@ import os
 import subprocess
 
 import count_opcodes
+import matrix
 
 
 def _mk_f(format_string : str):
@@ -55,6 +56,55 @@ _function_ = \
 limits = {
 "min_result_construct_value_move_destruct"     : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
 "min_result_next"                              : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
+# Generated by matrix.py. Ceilings are the opcodes in test1() counted by count_opcodes.py
+# with GCC 12.2 on x64, using the gcc flags in _compile_info_, plus 25% rounded up. Clang
+# ceilings are follow-up work, to be measured the same way with clang++. Until then the
+# clang counts are reported as skipped.
+"matrix_compare_nontrivial_error_code"         : { 'gcc' :  27 },
+"matrix_compare_nontrivial_int"                : { 'gcc' :  23 },
+"matrix_compare_nontrivial_status_code"        : { 'gcc' : 114 },
+"matrix_compare_trivial_error_code"            : { 'gcc' :  28 },
+"matrix_compare_trivial_int"                   : { 'gcc' :  24 },
+"matrix_compare_trivial_status_code"           : { 'gcc' : 114 },
+"matrix_compare_void_error_code"               : { 'gcc' :  22 },
+"matrix_compare_void_int"                      : { 'gcc' :  18 },
+"matrix_compare_void_status_code"              : { 'gcc' : 109 },
+"matrix_convert_nontrivial_error_code"         : { 'gcc' :  19 },
+"matrix_convert_nontrivial_int"                : { 'gcc' :  19 },
+"matrix_convert_nontrivial_status_code"        : { 'gcc' :  23 },
+"matrix_convert_trivial_error_code"            : { 'gcc' :  18 },
+"matrix_convert_trivial_int"                   : { 'gcc' :  18 },
+"matrix_convert_trivial_status_code"           : { 'gcc' :  23 },
+"matrix_convert_void_error_code"               : { 'gcc' :   8 },
+"matrix_convert_void_int"                      : { 'gcc' :   8 },
+"matrix_convert_void_status_code"              : { 'gcc' :  12 },
+"matrix_swap_nontrivial_error_code"            : { 'gcc' :  40 },
+"matrix_swap_nontrivial_int"                   : { 'gcc' :  39 },
+"matrix_swap_nontrivial_status_code"           : { 'gcc' :  42 },
+"matrix_swap_trivial_error_code"               : { 'gcc' :  13 },
+"matrix_swap_trivial_int"                      : { 'gcc' :  10 },
+"matrix_swap_trivial_status_code"              : { 'gcc' :  15 },
+"matrix_swap_void_error_code"                  : { 'gcc' :  13 },
+"matrix_swap_void_int"                         : { 'gcc' :  10 },
+"matrix_swap_void_status_code"                 : { 'gcc' :  15 },
+"matrix_try_nontrivial_error_code"             : { 'gcc' :  60 },
+"matrix_try_nontrivial_int"                    : { 'gcc' :  25 },
+"matrix_try_nontrivial_status_code"            : { 'gcc' :  67 },
+"matrix_try_trivial_error_code"                : { 'gcc' :  62 },
+"matrix_try_trivial_int"                       : { 'gcc' :  27 },
+"matrix_try_trivial_status_code"               : { 'gcc' :  57 },
+"matrix_try_void_error_code"                   : { 'gcc' :  62 },
+"matrix_try_void_int"                          : { 'gcc' :  23 },
+"matrix_try_void_status_code"                  : { 'gcc' :  54 },
+"matrix_value_or_nontrivial_error_code"        : { 'gcc' :   8 },
+"matrix_value_or_nontrivial_int"               : { 'gcc' :   9 },
+"matrix_value_or_nontrivial_status_code"       : { 'gcc' :   9 },
+"matrix_value_or_trivial_error_code"           : { 'gcc' :   7 },
+"matrix_value_or_trivial_int"                  : { 'gcc' :   5 },
+"matrix_value_or_trivial_status_code"          : { 'gcc' :   5 },
+"matrix_value_or_void_error_code"              : { 'gcc' :   3 },
+"matrix_value_or_void_int"                     : { 'gcc' :   3 },
+"matrix_value_or_void_status_code"             : { 'gcc' :   3 },
 }
 
 
@@ -131,6 +181,10 @@ def test_single(outname : str, func : str, src_file : str, compiler : str, inden
     if test_name in limits and compiler in limits[test_name] and limits[test_name][compiler] < count:
         xml_string += '  '*(indent+1) + '<failure message="Opcodes generated ' + \
             str(count) + ' exceeds limit ' + str(limits[test_name][compiler]) + '"/>\n'
+    elif test_name in limits and compiler not in limits[test_name]:
+        # Report a missing ceiling, rather than passing a count nothing checks
+        xml_string += '  '*(indent+1) + '<skipped message="No opcode limit for ' + \
+            compiler + ', ' + str(count) + ' opcodes generated"/>\n'
     xml_string += '  '*(indent+2) + '<system-out>\n' + output + '\n' + \
                   '  '*(indent+2) + '</system-out>\n' + \
                   '  '*indent + '</testcase>\n'
@@ -145,6 +199,7 @@ def list_src_files():
 
 
 def test_all(func : dict):
+    matrix.generate()
     xml_string = '<?xml version="1.0" encoding="UTF-8"?>\n' + \
                  '<testsuite name="constexpr">\n'
     # holds (compiler, name, count) tuples
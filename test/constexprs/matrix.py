@@ -0,0 +1,200 @@
+#!/usr/bin/python3
+# Generate the codegen quality matrix of value types, error types and operations
+# (C) 2026 Outcome contributors
+# File created: Oct 2026
+#
+# Each generated source contains a test1() performing one operation upon one
+# combination of value and error type, in the same shape as the hand written
+# sources alongside. compile_and_count.py writes them out before counting, and
+# holds their opcode ceilings in its limits table under the same names.
+
+_licence_ = r'''/* Canned codegen quality test sequences, generated by matrix.py
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+'''
+
+# Copyable, movable, comparable, and none of it trivial
+_nontrivial_ = r'''
+struct nontrivial
+{
+  int v;
+  nontrivial(int x) noexcept : v(x) {}
+  nontrivial(const nontrivial &o) noexcept : v(o.v) {}
+  nontrivial(nontrivial &&o) noexcept : v(o.v) { o.v = 0; }
+  nontrivial &operator=(const nontrivial &o) noexcept { v = o.v; return *this; }
+  nontrivial &operator=(nontrivial &&o) noexcept { v = o.v; o.v = 0; return *this; }
+  ~nontrivial() { foo = v; }
+  bool operator==(const nontrivial &o) const noexcept { return v == o.v; }
+  bool operator!=(const nontrivial &o) const noexcept { return v != o.v; }
+};
+struct wide_nontrivial : nontrivial
+{
+  wide_nontrivial(nontrivial &&o) noexcept : nontrivial(static_cast<nontrivial &&>(o)) {}
+};
+'''
+
+# name : (type, type converted to, value). The trivial type is not int, as result<int, int>
+# cannot be constructed, being unable to tell values from errors.
+values = {
+    'trivial': ('unsigned', 'unsigned long long', '5U'),
+    'nontrivial': ('nontrivial', 'wide_nontrivial', 'nontrivial(5)'),
+    'void': ('void', 'void', None),
+}
+
+# name : (header, result of {0}, outcome of {0}, failure)
+errors = {
+    'int': ('outcome.hpp', 'result<{0}, int, policy::terminate>', 'outcome<{0}, int, std::exception_ptr, policy::terminate>', 'failure(5)'),
+    'error_code': ('outcome.hpp', 'result<{0}>', 'outcome<{0}>', 'std::errc::argument_out_of_domain'),
+    'status_code': ('outcome-experimental.hpp', 'experimental::status_result<{0}>', 'experimental::status_outcome<{0}>', 'experimental::errc::argument_out_of_domain'),
+}
+
+# name : (source of test1() and anything it calls, body of main()), formatted with
+#   R: the result type, O: the outcome type converted to, T: the value type,
+#   V: a value, or nothing for void, F: a failure. Values are constructed in place,
+#   as an int error makes the implicit constructors ambiguous.
+operations = {
+    # Propagating a failure
+    'try': {
+        'value': (r'''extern QUICKCPPLIB_NOINLINE {R} src1() noexcept
+{{
+  return {F};
+}}
+
+extern QUICKCPPLIB_NOINLINE {R} test1() noexcept
+{{
+  OUTCOME_TRY(v, src1());
+  foo = 0;
+  return success(std::move(v));
+}}''', r'''  return test1().has_value();'''),
+        'void': (r'''extern QUICKCPPLIB_NOINLINE {R} src1() noexcept
+{{
+  return {F};
+}}
+
+extern QUICKCPPLIB_NOINLINE {R} test1() noexcept
+{{
+  OUTCOME_TRY(src1());
+  foo = 0;
+  return success();
+}}''', r'''  return test1().has_value();'''),
+    },
+    # A value, else a fallback
+    'value_or': {
+        'value': (r'''extern QUICKCPPLIB_NOINLINE {T} test1(const {R} &r) noexcept
+{{
+  return r.has_value() ? r.value() : {T}(0);
+}}''', r'''  {R} r(in_place_type<{T}>, {V});
+  return test1(r) == {T}(5) ? 0 : 1;'''),
+        'void': (r'''extern QUICKCPPLIB_NOINLINE int test1(const {R} &r) noexcept
+{{
+  return r.has_value() ? (r.value(), 1) : 0;
+}}''', r'''  {R} r(success());
+  return test1(r) ? 0 : 1;'''),
+    },
+    'swap': {
+        'value': (r'''extern QUICKCPPLIB_NOINLINE void test1({R} &a, {R} &b) noexcept
+{{
+  a.swap(b);
+}}''', r'''  {R} a(in_place_type<{T}>, {V}), b({F});
+  test1(a, b);
+  return a.has_value() ? 1 : 0;'''),
+        'void': (r'''extern QUICKCPPLIB_NOINLINE void test1({R} &a, {R} &b) noexcept
+{{
+  a.swap(b);
+}}''', r'''  {R} a(success()), b({F});
+  test1(a, b);
+  return a.has_value() ? 1 : 0;'''),
+    },
+    'compare': {
+        'value': (r'''extern QUICKCPPLIB_NOINLINE bool test1(const {R} &a, const {R} &b) noexcept
+{{
+  return a == b;
+}}''', r'''  {R} a(in_place_type<{T}>, {V}), b(in_place_type<{T}>, {V});
+  return test1(a, b) ? 0 : 1;'''),
+        'void': (r'''extern QUICKCPPLIB_NOINLINE bool test1(const {R} &a, const {R} &b) noexcept
+{{
+  return a == b;
+}}''', r'''  {R} a(success()), b(success());
+  return test1(a, b) ? 0 : 1;'''),
+    },
+    # A result into an outcome of a wider value type
+    'convert': {
+        'value': (r'''extern QUICKCPPLIB_NOINLINE {O} test1({R} &&r) noexcept
+{{
+  return {O}(std::move(r));
+}}''', r'''  return test1({R}(in_place_type<{T}>, {V})).has_value() ? 0 : 1;'''),
+        'void': (r'''extern QUICKCPPLIB_NOINLINE {O} test1({R} &&r) noexcept
+{{
+  return {O}(std::move(r));
+}}''', r'''  return test1({R}(success())).has_value() ? 0 : 1;'''),
+    },
+}
+
+
+def name(operation : str, value : str, error : str) -> str:
+    return 'matrix_' + operation + '_' + value + '_' + error
+
+
+def source(operation : str, value : str, error : str) -> str:
+    T, W, V = values[value]
+    header, R, O, F = errors[error]
+    test1, main = operations[operation]['void' if value == 'void' else 'value']
+    fmt = dict(R=R.format(T), O=O.format(W), T=T, V=V, F=F)
+    # The single headers use std::exception_ptr without including <exception> themselves
+    return _licence_ + r'''
+#include <exception>
+
+#include "../../single-header/''' + header + r'''"
+
+extern int foo;
+int foo;
+''' + (_nontrivial_ if value == 'nontrivial' else '') + r'''
+using namespace OUTCOME_V2_NAMESPACE;
+
+''' + test1.format(**fmt) + r'''
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+''' + main.format(**fmt) + r'''
+}
+'''
+
+
+def generate() -> list:
+    "Writes out every source in the matrix, returning their names"
+    ret = []
+    for operation in sorted(operations):
+        for value in sorted(values):
+            for error in sorted(errors):
+                src_file = name(operation, value, error) + '.cpp'
+                with open(src_file, 'wt') as oh:
+                    oh.write(source(operation, value, error))
+                ret.append(src_file)
+    return ret
+
+
+if __name__ == '__main__':
+    for src_file in generate():
+        print(src_file)
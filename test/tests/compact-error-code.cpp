@@ -0,0 +1,86 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/compact_error_code.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+namespace compact_error_code_test
+{
+  class category : public std::error_category
+  {
+  public:
+    const char *name() const noexcept override { return "compact_error_code_test"; }
+    std::string message(int c) const override { return "custom " + std::to_string(c); }
+  };
+  inline const category &custom_category()
+  {
+    static category v;
+    return v;
+  }
+}  // namespace compact_error_code_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / compact_error_code, "Tests that compact_error_code works as a result error type")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(compact_error_code) == 8, "");
+  static_assert(sizeof(result<int, compact_error_code>) < sizeof(result<int, std::error_code>), "");
+  static_assert(trait::is_error_code_available<compact_error_code>::value, "");
+
+  {  // lossless round trips
+    BOOST_CHECK(compact_error_code() == std::error_code());
+    BOOST_CHECK(std::error_code(compact_error_code()) == std::error_code());
+    const std::error_code a(EINVAL, std::generic_category()), b(ENOENT, std::system_category());
+    const std::error_code c(78, compact_error_code_test::custom_category());
+    BOOST_CHECK(std::error_code(compact_error_code(a)) == a);
+    BOOST_CHECK(std::error_code(compact_error_code(b)) == b);
+    BOOST_CHECK(std::error_code(compact_error_code(c)) == c);
+    BOOST_CHECK(compact_error_code(c) == c);
+    BOOST_CHECK(compact_error_code(c) != a);
+    BOOST_CHECK(compact_error_code(c).message() == "custom 78");
+    BOOST_CHECK(compact_error_code(c).category_index() == compact_error_code(79, compact_error_code_test::custom_category()).category_index());
+    BOOST_CHECK(compact_error_code(c).category_index() >= 2);
+    BOOST_CHECK(compact_error_code(std::make_error_code(std::errc::invalid_argument)) == std::errc::invalid_argument);
+    BOOST_CHECK(compact_error_code(b) == std::errc::no_such_file_or_directory);
+  }
+  {  // in a result
+    result<int, compact_error_code> a(5), b(std::errc::invalid_argument), c(std::error_code(3, compact_error_code_test::custom_category()));
+    BOOST_CHECK(a.value() == 5);
+    BOOST_CHECK(b.error() == std::errc::invalid_argument);
+    BOOST_CHECK(b._iostreams_state()._status.have_error_is_errno());
+    BOOST_CHECK(!c._iostreams_state()._status.have_error_is_errno());
+    BOOST_CHECK(c.error() == std::error_code(3, compact_error_code_test::custom_category()));
+#ifdef __cpp_exceptions
+    BOOST_CHECK_THROW(b.value(), std::system_error);
+    try
+    {
+      c.value();
+    }
+    catch(const std::system_error &e)
+    {
+      BOOST_CHECK(e.code() == std::error_code(3, compact_error_code_test::custom_category()));
+    }
+    outcome<int, compact_error_code> d(std::errc::invalid_argument);
+    BOOST_CHECK_THROW(std::rethrow_exception(d.failure()), std::system_error);
+#endif
+  }
+}
@@ -93,3 +93,60 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / comparison, "Tests that the outco
   // Should I do outcome<int>(5) == 5? Unsure if it's wise
 #endif
 }
+
+namespace comparison_test
+{
+  struct point
+  {
+    int x, y;
+    constexpr bool operator==(const point &o) const noexcept { return x == o.x && y == o.y; }
+    constexpr bool operator!=(const point &o) const noexcept { return !(*this == o); }
+  };
+}  // namespace comparison_test
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace trait
+{
+  template <> struct is_bytewise_comparable<comparison_test::point>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+OUTCOME_V2_NAMESPACE_END
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / identical, "Tests that results compare bytewise and identically")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // bytewise comparable values
+  {
+    result<comparison_test::point> a(comparison_test::point{1, 2}), b(comparison_test::point{1, 2}), c(comparison_test::point{2, 1}), d(std::errc::invalid_argument);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    BOOST_CHECK(a != d);
+    BOOST_CHECK(d != a);
+    constexpr result<comparison_test::point, int> e(comparison_test::point{1, 2}), f(comparison_test::point{1, 2});
+    static_assert(e == f, "");
+  }
+  // identical() never consults error categories
+  {
+    result<int> a(5), b(5), c(6), d(std::errc::invalid_argument), e(std::errc::invalid_argument), f(std::error_code(EINVAL, std::system_category()));
+    BOOST_CHECK(a.identical(b));
+    BOOST_CHECK(!a.identical(c));
+    BOOST_CHECK(!a.identical(d));
+    BOOST_CHECK(d.identical(e));
+    BOOST_CHECK(!d.identical(f));
+    result<void> g(success()), h(success());
+    BOOST_CHECK(g.identical(h));
+  }
+#if !defined(__APPLE__) || defined(__cpp_exceptions)
+  {
+    auto p = std::make_exception_ptr(std::runtime_error("hi"));
+    outcome<int> a(5), b(std::errc::invalid_argument), c(failure(make_error_code(std::errc::invalid_argument), p)), d(failure(make_error_code(std::errc::invalid_argument), p)), e(p);
+    BOOST_CHECK(a.identical(a));
+    BOOST_CHECK(b.identical(b));
+    BOOST_CHECK(!b.identical(c));
+    BOOST_CHECK(c.identical(d));
+    BOOST_CHECK(!c.identical(e));
+    BOOST_CHECK(e.identical(e));
+  }
+#endif
+}
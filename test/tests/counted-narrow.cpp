@@ -0,0 +1,74 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/policy/counted_narrow.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / counted_narrow, "Tests that the counted_narrow policy counts and records bad observer calls")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using counted_result = basic_result<void, std::error_code, policy::counted_narrow<std::error_code, void>>;
+  using counted_outcome = basic_outcome<int, std::error_code, std::exception_ptr, policy::counted_narrow<std::error_code, std::exception_ptr>>;
+
+  const uint64_t before = policy::counted_narrow_violations(), total_before = policy::counted_narrow_total_violations();
+  counted_result a(success()), b(std::errc::invalid_argument);
+  a.value();
+  b.error();
+  BOOST_CHECK(policy::counted_narrow_violations() == before);
+
+  // Bad calls do not throw nor terminate, they are counted and recorded
+  b.value();
+  (void) a.error();
+  counted_outcome c(5);
+  (void) c.exception();
+  BOOST_CHECK(policy::counted_narrow_violations() == before + 3);
+  BOOST_CHECK(policy::counted_narrow_total_violations() >= total_before + 3);
+
+  std::vector<policy::counted_narrow_violation> sites;
+  policy::for_each_counted_narrow_violation([&](const policy::counted_narrow_violation &v) { sites.push_back(v); });
+  BOOST_REQUIRE(sites.size() >= 3);
+  BOOST_CHECK(sites[sites.size() - 3].observer == 'v');
+  BOOST_CHECK(sites[sites.size() - 2].observer == 'e');
+  BOOST_CHECK(sites[sites.size() - 1].observer == 'x');
+  BOOST_CHECK(sites[sites.size() - 3].status == static_cast<uint16_t>(b._iostreams_state()._status.status_value));
+#if defined(__GNUC__) || defined(_MSC_VER)
+  BOOST_CHECK(sites.back().call_site != nullptr);
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / counted_narrow / checked, "Tests that the checked counted_narrow policy throws")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(std::is_base_of<policy::throw_bad_result_access<std::error_code, void>, policy::counted_narrow<std::error_code, void, true>>::value, "");
+  static_assert(!std::is_base_of<policy::throw_bad_result_access<std::error_code, void>, policy::counted_narrow<std::error_code, void>>::value, "");
+#ifdef __cpp_exceptions
+  using checked_result = basic_result<int, std::error_code, policy::counted_narrow<std::error_code, void, true>>;
+  const uint64_t before = policy::counted_narrow_violations();
+  checked_result a(std::errc::invalid_argument);
+  BOOST_CHECK_THROW(a.value(), bad_result_access);
+  BOOST_CHECK(policy::counted_narrow_violations() == before);
+#endif
+}
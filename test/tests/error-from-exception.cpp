@@ -0,0 +1,154 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome/utils.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <atomic>
+#include <ios>
+#include <thread>
+#include <vector>
+
+namespace error_from_exception_test
+{
+  struct custom_error : std::runtime_error
+  {
+    int code;
+    explicit custom_error(int c)
+        : std::runtime_error("custom")
+        , code(c)
+    {
+    }
+  };
+  struct derived_custom_error : custom_error
+  {
+    using custom_error::custom_error;
+  };
+  struct unregistered_error : std::runtime_error
+  {
+    using std::runtime_error::runtime_error;
+  };
+  inline std::error_code convert_custom_error(const custom_error &e) { return {e.code, std::generic_category()}; }
+
+#ifdef __cpp_exceptions
+  template <int N> struct threaded_error
+  {
+  };
+  static std::atomic<int> threaded_failures{0};
+  template <int N> inline void register_threaded_error()
+  {
+    if(!OUTCOME_V2_NAMESPACE::register_exception_to_error<threaded_error<N>>(std::error_code(100 + N, std::generic_category())))
+    {
+      ++threaded_failures;
+    }
+  }
+  template <int... Ns> inline void register_threaded_errors(std::vector<std::thread> &threads)
+  {
+    using expand = int[];
+    (void) expand{0, (threads.emplace_back(&register_threaded_error<Ns>), 0)...};
+  }
+#endif
+}  // namespace error_from_exception_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_from_exception, "Tests that error_from_exception classifies exceptions, caching by type and consulting the registry")
+{
+#ifdef __cpp_exceptions
+  using namespace error_from_exception_test;
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  const auto eagain = std::make_error_code(std::errc::resource_unavailable_try_again);
+  const auto notmatched = std::make_error_code(std::errc::operation_not_supported);
+  auto classify = [&](std::exception_ptr ep) { return outcome::error_from_exception(static_cast<std::exception_ptr &&>(ep), notmatched); };
+
+  // Classification must be the same the first time a type is seen as it is when cached
+  for(int n = 0; n < 2; n++)
+  {
+    BOOST_CHECK(classify(std::make_exception_ptr(std::invalid_argument("x"))) == std::errc::invalid_argument);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::out_of_range("x"))) == std::errc::result_out_of_range);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::logic_error("x"))) == std::errc::invalid_argument);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::overflow_error("x"))) == std::errc::value_too_large);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::bad_alloc())) == std::errc::not_enough_memory);
+    BOOST_CHECK(classify(std::make_exception_ptr(unregistered_error("x"))) == eagain);
+    // Value dependent mappings read the thrown object, including through derived types
+    BOOST_CHECK(classify(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::no_such_device)))) == std::errc::no_such_device);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::io_error)))) == std::errc::io_error);
+    BOOST_CHECK(classify(std::make_exception_ptr(std::ios_base::failure("x", std::make_error_code(std::errc::broken_pipe)))) == std::errc::broken_pipe);
+    // Unmatched exceptions are left in place
+    auto ep = std::make_exception_ptr(5);
+    BOOST_CHECK(outcome::error_from_exception(static_cast<std::exception_ptr &&>(ep), notmatched) == notmatched);
+    BOOST_CHECK(ep);
+  }
+  // Matched exceptions are consumed
+  {
+    auto ep = std::make_exception_ptr(std::domain_error("x"));
+    BOOST_CHECK(outcome::error_from_exception(static_cast<std::exception_ptr &&>(ep), notmatched) == std::errc::argument_out_of_domain);
+    BOOST_CHECK(!ep);
+  }
+
+  // Before registration custom_error is a runtime_error, afterwards registered mappings win
+  BOOST_CHECK(classify(std::make_exception_ptr(custom_error(EXDEV))) == eagain);
+  BOOST_CHECK(outcome::register_exception_to_error<custom_error>(&convert_custom_error));
+  BOOST_CHECK(outcome::register_exception_to_error<int>(std::make_error_code(std::errc::bad_message)));
+  for(int n = 0; n < 2; n++)
+  {
+    BOOST_CHECK(classify(std::make_exception_ptr(custom_error(EXDEV))) == std::errc::cross_device_link);
+    BOOST_CHECK(classify(std::make_exception_ptr(derived_custom_error(EROFS))) == std::errc::read_only_file_system);
+    BOOST_CHECK(classify(std::make_exception_ptr(5)) == std::errc::bad_message);
+    BOOST_CHECK(classify(std::make_exception_ptr(unregistered_error("x"))) == eagain);
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_from_exception / concurrent_registration, "Tests that concurrent registrations are all kept while classifying")
+{
+#ifdef __cpp_exceptions
+  using namespace error_from_exception_test;
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  const auto notmatched = std::make_error_code(std::errc::operation_not_supported);
+  auto classify = [&](std::exception_ptr ep) { return outcome::error_from_exception(static_cast<std::exception_ptr &&>(ep), notmatched); };
+
+  // Classify the types before registration, so the cache holds entries which must be superseded
+  BOOST_CHECK(classify(std::make_exception_ptr(threaded_error<0>())) == notmatched);
+  BOOST_CHECK(classify(std::make_exception_ptr(threaded_error<7>())) == notmatched);
+  std::vector<std::thread> threads;
+  threads.emplace_back([&] {
+    for(int n = 0; n < 1000; n++)
+    {
+      if(classify(std::make_exception_ptr(std::overflow_error("x"))) != std::errc::value_too_large)
+      {
+        ++threaded_failures;
+      }
+    }
+  });
+  register_threaded_errors<0, 1, 2, 3, 4, 5, 6, 7>(threads);
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  BOOST_CHECK(threaded_failures == 0);
+  BOOST_CHECK(classify(std::make_exception_ptr(threaded_error<0>())).value() == 100);
+  BOOST_CHECK(classify(std::make_exception_ptr(threaded_error<3>())).value() == 103);
+  BOOST_CHECK(classify(std::make_exception_ptr(threaded_error<7>())).value() == 107);
+  BOOST_CHECK(classify(std::make_exception_ptr(std::overflow_error("x"))) == std::errc::value_too_large);
+#endif
+}
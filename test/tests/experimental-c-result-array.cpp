@@ -0,0 +1,76 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/result.h"
+#include "../../include/outcome/experimental/status_result.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+CXX_DECLARE_RESULT_ERRNO(array_test, long);
+CXX_DECLARE_RESULT_ERRNO_ARRAY(array_test);
+CXX_RESULT_STATIC_ASSERT_LAYOUT(posix_array_test, OUTCOME_V2_NAMESPACE::experimental::status_result<long, SYSTEM_ERROR2_NAMESPACE::posix_code>);
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result_array, "Tests the C helpers for arrays of results")
+{
+  using namespace OUTCOME_V2_NAMESPACE::experimental;
+  using cxx_result = status_result<long, SYSTEM_ERROR2_NAMESPACE::posix_code>;
+  using c_result = CXX_RESULT_ERRNO(array_test);
+
+  // 100 results, every seventh of which failed with an errno code. As the layouts are
+  // the same, each C++ result can be copied bytewise into the C array.
+  c_result c[100];
+  bool has_value[100];
+  for(size_t n = 0; n < 100; n++)
+  {
+    cxx_result r = (n % 7 == 3) ? cxx_result(SYSTEM_ERROR2_NAMESPACE::posix_code(static_cast<int>(EINVAL + n))) : cxx_result(static_cast<long>(n));
+    has_value[n] = r.has_value();
+    memcpy(static_cast<void *>(&c[n]), static_cast<const void *>(&r), sizeof(r));
+  }
+  BOOST_CHECK(c[5].value == 5);
+  BOOST_CHECK(c[3].error.value == EINVAL + 3);
+
+  BOOST_CHECK(CXX_RESULT_ERRNO_ARRAY_FIRST_FAILURE(array_test, c, 100) == 3);
+  BOOST_CHECK(CXX_RESULT_ERRNO_ARRAY_FIRST_FAILURE(array_test, c, 3) == 3);
+  BOOST_CHECK(CXX_RESULT_ERRNO_ARRAY_FIRST_FAILURE(array_test, c + 4, 6) == 6);
+
+  uint64_t bitmap[2];
+  BOOST_CHECK(CXX_RESULT_ERRNO_ARRAY_STATUS_BITMAP(array_test, bitmap, c, 100) == 14);
+  for(size_t n = 0; n < 100; n++)
+  {
+    BOOST_CHECK(((bitmap[n / 64] >> (n % 64)) & 1) == (has_value[n] ? 1U : 0U));
+  }
+  BOOST_CHECK((bitmap[1] >> 36) == 0);
+
+  // Errno conversion, with results whose error is not an errno code given the fallback
+  c[11].flags = 2U;
+  c[11].error.value = 99999;
+  int errnos[100];
+  BOOST_CHECK(CXX_RESULT_ERRNO_ARRAY_TO_ERRNO(array_test, errnos, c, 100, EIO) == 15);
+  BOOST_CHECK(errnos[0] == 0);
+  BOOST_CHECK(errnos[3] == EINVAL + 3);
+  BOOST_CHECK(errnos[11] == EIO);
+  BOOST_CHECK(errnos[94] == EINVAL + 94);
+}
@@ -0,0 +1,95 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_DEFINE_C_API
+#include "../../include/outcome/experimental/status_code_domain_registry.hpp"
+#include "../../include/outcome/experimental/status_result.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / domain_registry, "Tests the C API for looking up status code domains")
+{
+  using namespace OUTCOME_V2_NAMESPACE::experimental;
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+
+  BOOST_CHECK(cxx_status_code_domain_lookup(nullptr) == nullptr);
+
+  // As C sees a system_code
+  system_code sc = posix_code(ENOENT);
+  CXX_STATUS_CODE(system) c;
+  static_assert(sizeof(c) == sizeof(sc), "C and C++ system codes differ in size");
+  memcpy(&c, static_cast<const void *>(&sc), sizeof(c));
+
+  const cxx_status_code_domain_info *info = cxx_status_code_domain_lookup(c.domain);
+  BOOST_REQUIRE(info != nullptr);
+  BOOST_CHECK(info->domain == &sc.domain());
+  BOOST_CHECK(info->id == sc.domain().id());
+  BOOST_CHECK(0 == strcmp(info->name, "posix domain"));
+  BOOST_CHECK(info->flags == CXX_STATUS_CODE_DOMAIN_ERRNO);
+  BOOST_CHECK(info->index < OUTCOME_STATUS_CODE_DOMAIN_REGISTRY_SLOTS);
+
+  // Lookups are cached, as are messages
+  BOOST_CHECK(cxx_status_code_domain_lookup(c.domain) == info);
+  const char *msg = CXX_STATUS_CODE_MESSAGE(info, c);
+  BOOST_CHECK(0 == strcmp(msg, sc.message().c_str()));
+  BOOST_CHECK(CXX_STATUS_CODE_MESSAGE(info, c) == msg);
+
+  // Other domains get other descriptors
+  const cxx_status_code_domain_info *info2 = status_code_domain_lookup(&generic_code(errc::invalid_argument).domain());
+  BOOST_REQUIRE(info2 != nullptr);
+  BOOST_CHECK(info2 != info);
+  BOOST_CHECK(info2->index != info->index);
+  BOOST_CHECK(0 == strcmp(info2->name, "generic domain"));
+  BOOST_CHECK(info2->flags == CXX_STATUS_CODE_DOMAIN_ERRNO);
+  BOOST_CHECK(0 == strcmp(info2->message(info2, static_cast<intptr_t>(errc::invalid_argument)), generic_code(errc::invalid_argument).message().c_str()));
+
+  // A second copy of a domain, as each shared library may have, compares equal to the
+  // first and so shares its descriptor and index
+  {
+    static constexpr _posix_code_domain other_posix_domain;
+    BOOST_REQUIRE(&other_posix_domain != &sc.domain());
+    BOOST_CHECK(status_code_domain_lookup(&other_posix_domain) == info);
+    BOOST_CHECK(info->domain == &sc.domain());
+  }
+
+  // Indirecting domains, whose value is a pointer to heap storage, are described but have
+  // no messages, as the storage of one code may be reused for another
+  {
+    system_code p1 = make_status_code_ptr(posix_code(ENOENT));
+    CXX_STATUS_CODE(system) c1;
+    memcpy(&c1, static_cast<const void *>(&p1), sizeof(c1));
+    const cxx_status_code_domain_info *info3 = cxx_status_code_domain_lookup(c1.domain);
+    BOOST_REQUIRE(info3 != nullptr);
+    BOOST_CHECK(info3 != info);
+    BOOST_CHECK(info3->flags == 0);
+    BOOST_CHECK(CXX_STATUS_CODE_MESSAGE(info3, c1) == nullptr);
+    p1 = make_status_code_ptr(posix_code(EACCES));
+    CXX_STATUS_CODE(system) c2;
+    memcpy(&c2, static_cast<const void *>(&p1), sizeof(c2));
+    BOOST_CHECK(cxx_status_code_domain_lookup(c2.domain) == info3);
+    BOOST_CHECK(CXX_STATUS_CODE_MESSAGE(info3, c2) == nullptr);
+  }
+}
@@ -0,0 +1,86 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_STATUS_EXCEPTION_PTR_CACHE_SIZE 64
+#include "../../include/outcome/experimental/status_outcome.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / exception_ptr, "Tests that status outcome failures are converted into exception ptrs without throwing")
+{
+#ifdef __cpp_exceptions
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  using OUTCOME_V2_NAMESPACE::experimental::status_outcome;
+
+  // Returns the code held by the status_error in the exception ptr
+  auto code_of = [](const std::exception_ptr &ep) -> system_code {
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const status_error<_posix_code_domain> &e)
+    {
+      return e.code();
+    }
+    catch(const generic_error &e)
+    {
+      return e.code();
+    }
+    catch(...)
+    {
+    }
+    return {};
+  };
+
+  {  // typed codes make the same exception the domain would throw
+    status_outcome<int, posix_code> m(posix_code(EINVAL));
+    BOOST_CHECK_THROW(std::rethrow_exception(m.failure()), status_error<_posix_code_domain>);
+    BOOST_CHECK(code_of(m.failure()) == posix_code(EINVAL));
+    status_outcome<int, generic_code> n(generic_code(errc::bad_address));
+    BOOST_CHECK_THROW(std::rethrow_exception(n.failure()), generic_error);
+    BOOST_CHECK(code_of(n.failure()) == errc::bad_address);
+  }
+  {  // erased codes are converted back to their typed code
+    status_outcome<int> m(posix_code(ENOENT));
+    BOOST_CHECK_THROW(std::rethrow_exception(m.failure()), status_error<_posix_code_domain>);
+    BOOST_CHECK(code_of(m.failure()) == posix_code(ENOENT));
+    status_outcome<void> n(generic_code(errc::permission_denied));
+    BOOST_CHECK_THROW(std::rethrow_exception(n.failure()), generic_error);
+    BOOST_CHECK(code_of(n.failure()) == errc::permission_denied);
+  }
+  {  // exception ptrs for small values are cached
+    status_outcome<int> a(posix_code(EIO)), b(posix_code(EIO)), c(posix_code(EBADF));
+    BOOST_CHECK(a.failure() == b.failure());
+    BOOST_CHECK(a.failure() != c.failure());
+    status_outcome<int> d(posix_code(1000)), e(posix_code(1000));
+    BOOST_CHECK(d.failure() != e.failure());
+    BOOST_CHECK(code_of(d.failure()) == posix_code(1000));
+  }
+  {  // an exception overrides the error
+    status_outcome<int> m(generic_code(errc::bad_address), std::make_exception_ptr(std::logic_error("hi")));
+    BOOST_CHECK_THROW(std::rethrow_exception(m.failure()), std::logic_error);
+  }
+#endif
+}
@@ -0,0 +1,59 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// Instantiate the specialisations here, as the library which would otherwise is not linked
+#define OUTCOME_EXTERN_TEMPLATES 1
+#define OUTCOME_EXTERN_TEMPLATE
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / extern_templates, "Tests that the extern template specialisations instantiate and work")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  result<void> a(success()), b(std::errc::invalid_argument);
+  BOOST_CHECK(a.has_value());
+  BOOST_CHECK(b.error() == std::errc::invalid_argument);
+
+  result<int> c(5), d(std::errc::invalid_argument);
+  BOOST_CHECK(c.value() == 5);
+  BOOST_CHECK(c != d);
+  c.swap(d);
+  BOOST_CHECK(d.value() == 5);
+  BOOST_CHECK(c.has_error());
+
+  result<std::string> e(std::string("hello")), f(e);
+  BOOST_CHECK(f.value() == "hello");
+  f = std::errc::invalid_argument;
+  BOOST_CHECK(f.has_error());
+  BOOST_CHECK(e.assume_value() == "hello");
+
+  outcome<int> g(5), h(c.as_failure());
+  BOOST_CHECK(g.value() == 5);
+  BOOST_CHECK(h.has_error());
+  BOOST_CHECK(!h.has_exception());
+#ifdef __cpp_exceptions
+  outcome<int> i(std::make_exception_ptr(5));
+  BOOST_CHECK(i.has_exception());
+  BOOST_CHECK(i.failure() == i.exception());
+#endif
+}
@@ -0,0 +1,118 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/iostream_support.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+static std::atomic<size_t> interned_message_allocations{0};
+void *operator new(size_t n)
+{
+  interned_message_allocations.fetch_add(1, std::memory_order_relaxed);
+  void *ret = ::malloc(n != 0 ? n : 1);
+  if(ret == nullptr)
+  {
+    std::abort();
+  }
+  return ret;
+}
+void operator delete(void *p) noexcept { ::free(p); }
+void operator delete(void *p, size_t /*unused*/) noexcept { ::free(p); }
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / iostream / interned_message, "Tests that error code messages are interned")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  const std::error_code a(ECONNRESET, std::generic_category()), b(ECONNRESET, std::system_category()), c(EINVAL, std::generic_category());
+
+  std::string fallback;
+  const std::string &am = interned_message(a, fallback);
+  BOOST_CHECK(am == a.message());
+  BOOST_CHECK(&am != &fallback);
+  BOOST_CHECK(&interned_message(b, fallback) != &am);
+  BOOST_CHECK(&interned_message(c, fallback) != &am);
+  BOOST_CHECK(interned_message(c, fallback) == c.message());
+
+  // Lookups of an interned message do not allocate
+  const size_t before = interned_message_allocations.load();
+  int mismatches = 0;
+  for(int n = 0; n < 1000; n++)
+  {
+    mismatches += static_cast<int>(&interned_message(a, fallback) != &am);
+  }
+  const size_t after = interned_message_allocations.load();
+  BOOST_CHECK(mismatches == 0);
+  BOOST_CHECK(after == before);
+
+  // Concurrent first insertions agree
+  std::vector<const std::string *> seen(8);
+  {
+    std::vector<std::thread> threads;
+    for(size_t n = 0; n < seen.size(); n++)
+    {
+      threads.emplace_back([&seen, n] {
+        std::string mine;
+        seen[n] = &interned_message(std::error_code(EPIPE, std::generic_category()), mine);
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+  }
+  for(auto *i : seen)
+  {
+    BOOST_CHECK(i == seen[0]);
+  }
+
+  result<int> r(a);
+  BOOST_CHECK(print(r).find(am) != std::string::npos);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / iostream / interned_message_full, "Tests that messages which cannot be interned are still correct")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // Far more distinct codes than the table holds
+  int wrong = 0, uninterned = 0;
+  for(int n = 0; n < 4 * OUTCOME_INTERNED_MESSAGE_SLOTS; n++)
+  {
+    const std::error_code ec(n, std::generic_category());
+    std::string fallback;
+    const std::string &m = interned_message(ec, fallback);
+    wrong += static_cast<int>(m != ec.message());
+    uninterned += static_cast<int>(&m == &fallback);
+  }
+  BOOST_CHECK(wrong == 0);
+  BOOST_CHECK(uninterned > 0);
+
+  // Two uninterned messages formatted in one expression do not overwrite one another
+  const std::error_code x(4 * OUTCOME_INTERNED_MESSAGE_SLOTS + 1, std::generic_category()), y(4 * OUTCOME_INTERNED_MESSAGE_SLOTS + 2, std::generic_category());
+  std::string fx, fy;
+  BOOST_CHECK(interned_message(x, fx) + interned_message(y, fy) == x.message() + y.message());
+  result<int> r1(x), r2(y);
+  BOOST_CHECK(print(r1).find(x.message()) != std::string::npos);
+  BOOST_CHECK(print(r2).find(y.message()) != std::string::npos);
+}
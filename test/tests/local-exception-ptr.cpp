@@ -0,0 +1,86 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/local_exception_ptr.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / local_exception_ptr, "Tests that outcome works with a non-atomic exception ptr")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using local_outcome = outcome<int, std::error_code, local_exception_ptr>;
+  static_assert(trait::is_exception_ptr_available<local_exception_ptr>::value, "");
+  static_assert(!std::is_convertible<local_exception_ptr, std::exception_ptr>::value, "");
+  static_assert(std::is_constructible<std::exception_ptr, local_exception_ptr>::value, "");
+
+  {  // null handles
+    local_exception_ptr a, b(nullptr);
+    BOOST_CHECK(!a);
+    BOOST_CHECK(a == nullptr);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a.use_count() == 0);
+    BOOST_CHECK(a.to_exception_ptr() == nullptr);
+  }
+  {  // valued and errored outcomes
+    local_outcome a(5), b(std::errc::invalid_argument);
+    local_outcome c(a), d(b);
+    BOOST_CHECK(c.value() == 5);
+    BOOST_CHECK(d.error() == std::errc::invalid_argument);
+  }
+#ifdef __cpp_exceptions
+  {  // copies share the exception without atomics
+    local_exception_ptr ep(std::make_exception_ptr(std::runtime_error("hi")));
+    BOOST_CHECK(ep);
+    BOOST_CHECK(ep.use_count() == 1);
+    local_outcome a(ep);
+    BOOST_CHECK(ep.use_count() == 2);
+    {
+      local_outcome b(a), c(a);
+      BOOST_CHECK(ep.use_count() == 4);
+      BOOST_CHECK(b.exception() == ep);
+      local_outcome d(std::move(b));
+      BOOST_CHECK(ep.use_count() == 4);
+    }
+    BOOST_CHECK(ep.use_count() == 2);
+    BOOST_CHECK(a.has_exception());
+    BOOST_CHECK_THROW(a.value(), std::runtime_error);
+    BOOST_CHECK_THROW(rethrow_exception(a.exception()), std::runtime_error);
+    BOOST_CHECK_THROW(std::rethrow_exception(static_cast<std::exception_ptr>(a.exception())), std::runtime_error);
+    BOOST_CHECK(a.failure() == ep);
+  }
+  {  // failure() from an error converts
+    local_outcome a(std::errc::invalid_argument);
+    BOOST_CHECK(a.failure());
+    BOOST_CHECK_THROW(rethrow_exception(a.failure()), std::system_error);
+  }
+  {  // interop with std::exception_ptr outcomes
+    outcome<int> a(std::make_exception_ptr(std::logic_error("hi")));
+    local_outcome b(a);
+    BOOST_CHECK_THROW(b.value(), std::logic_error);
+    outcome<int> c(b);
+    BOOST_CHECK(c.exception() == a.exception());
+  }
+#endif
+}
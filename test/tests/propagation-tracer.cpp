@@ -0,0 +1,159 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#define OUTCOME_ENABLE_PROPAGATION_TRACER 1
+
+#include "../../include/outcome/propagation_tracer.hpp"
+#include "../../include/outcome/sampled_backtrace.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <sstream>
+
+namespace propagation_tracer_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  namespace sampled_backtrace = OUTCOME_V2_NAMESPACE::sampled_backtrace;
+
+  static unsigned line1, line2, line3;
+
+  inline outcome::result<int> f0(int x)
+  {
+    if(x > 0)
+    {
+      return x;
+    }
+    return std::errc::invalid_argument;
+  }
+  inline outcome::result<int> f1(int x)
+  {
+    line1 = __LINE__ + 1;
+    OUTCOME_TRY(v, f0(x));
+    return v;
+  }
+  inline outcome::outcome<long> f2(int x)
+  {
+    line2 = __LINE__ + 1;
+    OUTCOME_TRY(v, f1(x));
+    return v;
+  }
+  inline outcome::outcome<void> f3(int x)
+  {
+    line3 = __LINE__ + 1;
+    OUTCOME_TRYV(f2(x));
+    return outcome::success();
+  }
+  // Returns the propagated failure without constructing a result from it
+  inline outcome::failure_type<std::error_code> f4(int x)
+  {
+    OUTCOME_TRYV(f0(x));
+    return outcome::failure(std::error_code());
+  }
+  inline sampled_backtrace::result<int> f5(int x)
+  {
+    OUTCOME_TRY(v, f0(x));
+    return v;
+  }
+}  // namespace propagation_tracer_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / propagation_tracer, "Tests that the propagation tracer records the path failures take through TRY")
+{
+  using namespace propagation_tracer_test;
+  namespace propagation_tracer = outcome::propagation_tracer;
+  propagation_tracer::reset();
+
+  // Successes are never traced
+  BOOST_CHECK(f3(1));
+  BOOST_CHECK(propagation_tracer::histograms().empty());
+
+  // A failure made by f0 and returned by f3 crosses three frames
+  auto r = f3(0);
+  BOOST_REQUIRE(!r);
+  auto path = propagation_tracer::path_of(r);
+  BOOST_REQUIRE(path.size() == 3);
+  BOOST_CHECK(path[0].line == line1);
+  BOOST_CHECK(path[1].line == line2);
+  BOOST_CHECK(path[2].line == line3);
+
+  // A failure from f1 directly crosses one
+  for(int n = 0; n < 4; n++)
+  {
+    auto r1 = f1(0);
+    BOOST_CHECK(propagation_tracer::path_of(r1).size() == 1);
+  }
+  // A failure constructed directly has no path
+  outcome::result<int> r2(outcome::failure(std::make_error_code(std::errc::invalid_argument)));
+  BOOST_CHECK(propagation_tracer::path_of(r2).empty());
+
+  auto hs = propagation_tracer::histograms();
+  BOOST_REQUIRE(hs.size() == 1);
+  BOOST_CHECK(hs[0].origin.line == line1);
+  BOOST_CHECK(hs[0].total() == 5);
+  BOOST_CHECK(hs[0].hops[1] == 4);
+  BOOST_CHECK(hs[0].hops[3] == 1);
+
+  std::stringstream s;
+  propagation_tracer::dump(s);
+  BOOST_CHECK(s.str().find("3 hops: 1") != std::string::npos);
+  propagation_tracer::reset();
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / propagation_tracer / adopt, "Tests that only the result returned by TRY adopts the propagated failure")
+{
+  using namespace propagation_tracer_test;
+  namespace propagation_tracer = outcome::propagation_tracer;
+  propagation_tracer::reset();
+
+  // A propagated failure which no result is constructed from is not adopted by the next failure constructed
+  auto f = f4(0);
+  (void) f;
+  outcome::result<int> r1(outcome::failure(std::make_error_code(std::errc::invalid_argument)));
+  BOOST_CHECK(propagation_tracer::path_of(r1).empty());
+  propagation_tracer::reset();
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / propagation_tracer / sampled_backtrace, "Tests that the propagation tracer and sampled backtraces share spare storage")
+{
+  using namespace propagation_tracer_test;
+  namespace propagation_tracer = outcome::propagation_tracer;
+  propagation_tracer::reset();
+  const uint32_t oldrate = sampled_backtrace::sample_rate();
+  sampled_backtrace::set_sample_rate(1);
+
+  // Each error constructed captures a backtrace, and keeps it when the tracer adopts the failure
+  auto r = f5(0);
+  BOOST_CHECK(propagation_tracer::path_of(r).size() == 1);
+#ifndef OUTCOME_DISABLE_EXECINFO
+  BOOST_CHECK(sampled_backtrace::backtrace_of(r));
+#endif
+  for(int n = 0; n < 300; n++)
+  {
+    auto r2 = f5(0);
+    BOOST_CHECK(propagation_tracer::path_of(r2).size() == 1);
+#ifndef OUTCOME_DISABLE_EXECINFO
+    BOOST_CHECK(sampled_backtrace::backtrace_of(r2));
+#endif
+  }
+  sampled_backtrace::set_sample_rate(oldrate);
+  propagation_tracer::reset();
+}
@@ -0,0 +1,129 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/policy/report_and_continue.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <csetjmp>
+#include <string>
+
+namespace report_and_continue_test
+{
+  static int reports;
+  static OUTCOME_V2_NAMESPACE::policy::report_and_continue_failure last;
+  static std::error_code last_error;
+  static std::jmp_buf request_boundary;
+
+  static void log_and_continue(const OUTCOME_V2_NAMESPACE::policy::report_and_continue_failure &failure, const std::error_code *error)
+  {
+    ++reports;
+    last = failure;
+    last_error = (error != nullptr) ? *error : std::error_code();
+  }
+  static void abandon_request(const OUTCOME_V2_NAMESPACE::policy::report_and_continue_failure & /*unused*/, const std::error_code * /*unused*/) { std::longjmp(request_boundary, 1); }
+}  // namespace report_and_continue_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / policy / report_and_continue, "Tests that the report_and_continue policy calls the handler and continues")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace report_and_continue_test;
+  using rc_result = basic_result<int, std::error_code, policy::report_and_continue<std::error_code, void>>;
+  using rc_string_result = basic_result<std::string, std::error_code, policy::report_and_continue<std::error_code, void>>;
+  using rc_outcome = basic_outcome<int, std::error_code, std::exception_ptr, policy::report_and_continue<std::error_code, std::exception_ptr>>;
+
+  auto *prev = policy::set_report_and_continue_handler<std::error_code>(log_and_continue);
+  BOOST_CHECK(prev == nullptr);
+
+  // Good calls do not report
+  rc_result a(5);
+  BOOST_CHECK(a.value() == 5);
+  BOOST_CHECK(reports == 0);
+
+  // A bad value() reports the status, error and object, then returns a default constructed value
+  rc_result b(std::errc::invalid_argument);
+  BOOST_CHECK(b.value() == 0);
+  BOOST_CHECK(reports == 1);
+  BOOST_CHECK(last.observer == 'v');
+  BOOST_CHECK(last.object == &b);
+  BOOST_CHECK(last_error == std::errc::invalid_argument);
+  BOOST_CHECK((last.status & 2) != 0);  // have_error
+#if defined(__GNUC__) || defined(_MSC_VER)
+  BOOST_CHECK(last.call_site != nullptr);
+#endif
+  // The object is left untouched, so it still has its error and a second call reports again
+  BOOST_CHECK(b.has_error());
+  BOOST_CHECK(b.error() == std::errc::invalid_argument);
+  BOOST_CHECK(&b.value() != &a.value());
+  BOOST_CHECK(reports == 2);
+  BOOST_CHECK(b.value() == 0);
+  BOOST_CHECK(reports == 3);
+
+  // Also through a const reference, and for values with non-trivial destructors, and a
+  // default value modified by one caller is default constructed again for the next
+  {
+    rc_string_result c(std::errc::not_enough_memory);
+    const rc_string_result &cc = c;
+    BOOST_CHECK(cc.value().empty());
+    BOOST_CHECK(reports == 4);
+    c.value() = "a long string which does not fit into the small string buffer";
+    BOOST_CHECK(reports == 5);
+    BOOST_CHECK(cc.value().empty());
+    BOOST_CHECK(reports == 6);
+    BOOST_CHECK(c.has_error());
+    BOOST_CHECK(std::move(c).value().empty());
+    BOOST_CHECK(reports == 7);
+  }
+
+  // A bad error() reports without an error, and returns the default constructed error
+  BOOST_CHECK(!a.error());
+  BOOST_CHECK(reports == 8);
+  BOOST_CHECK(last.observer == 'e');
+  BOOST_CHECK(!last_error);
+
+  // Outcome value and exception observers
+  rc_outcome d(std::errc::timed_out);
+  BOOST_CHECK(!d.exception());
+  BOOST_CHECK(reports == 9);
+  BOOST_CHECK(last.observer == 'x');
+  BOOST_CHECK(last_error == std::errc::timed_out);
+  BOOST_CHECK(d.value() == 0);
+  BOOST_CHECK(reports == 10);
+  BOOST_CHECK(d.has_error());
+
+  // The handler may instead abandon the request
+  policy::set_report_and_continue_handler<std::error_code>(abandon_request);
+  volatile bool abandoned = false;
+  if(setjmp(request_boundary) == 0)
+  {
+    rc_result e(std::errc::invalid_argument);
+    (void) e.value();
+    BOOST_CHECK(false);
+  }
+  else
+  {
+    abandoned = true;
+  }
+  BOOST_CHECK(abandoned);
+  policy::set_report_and_continue_handler<std::error_code>(nullptr);
+}
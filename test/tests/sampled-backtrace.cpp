@@ -0,0 +1,90 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome/sampled_backtrace.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+namespace sampled_backtrace_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  namespace sampled_backtrace = OUTCOME_V2_NAMESPACE::sampled_backtrace;
+
+  extern QUICKCPPLIB_NOINLINE sampled_backtrace::result<int> fail(int x)
+  {
+    if(x > 0)
+    {
+      return x;
+    }
+    return std::errc::resource_unavailable_try_again;
+  }
+}  // namespace sampled_backtrace_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / sampled_backtrace, "Tests that errored results capture a backtrace one in N times and symbolise it lazily")
+{
+  using namespace sampled_backtrace_test;
+  const uint32_t oldrate = sampled_backtrace::sample_rate();
+
+  // Successful results never capture
+  sampled_backtrace::set_sample_rate(1);
+  auto r0 = fail(1);
+  BOOST_CHECK(outcome::hooks::spare_storage(&r0) == 0);
+  BOOST_CHECK(!sampled_backtrace::backtrace_of(r0));
+
+  // Every errored result captures at a rate of one
+  auto r1 = fail(0);
+#ifndef OUTCOME_DISABLE_EXECINFO
+  BOOST_CHECK(outcome::hooks::spare_storage(&r1) != 0);
+  auto t1 = sampled_backtrace::backtrace_of(r1);
+  BOOST_REQUIRE(t1);
+  BOOST_CHECK(!t1.frames().empty());
+  BOOST_CHECK(t1.symbols().size() == t1.frames().size());
+
+  // Conversion to outcome keeps the backtrace
+  sampled_backtrace::outcome<int> o1(r1);
+  BOOST_CHECK(sampled_backtrace::backtrace_of(o1).frames() == t1.frames());
+#endif
+
+  // One in four errored results captures
+  sampled_backtrace::set_sample_rate(4);
+  int captured = 0;
+  for(int n = 0; n < 80; n++)
+  {
+    auto r = fail(0);
+    if(sampled_backtrace::backtrace_of(r))
+    {
+      captured++;
+    }
+  }
+#ifndef OUTCOME_DISABLE_EXECINFO
+  BOOST_CHECK(captured == 20);
+  // r1's slot has since been reused, which is detected
+  BOOST_CHECK(!sampled_backtrace::backtrace_of(r1));
+#endif
+
+  // Zero disables capture
+  sampled_backtrace::set_sample_rate(0);
+  auto r2 = fail(0);
+  BOOST_CHECK(outcome::hooks::spare_storage(&r2) == 0);
+  sampled_backtrace::set_sample_rate(oldrate);
+}
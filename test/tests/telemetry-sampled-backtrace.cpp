@@ -0,0 +1,70 @@
+/* Unit testing for telemetry and sampled backtraces together
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome/sampled_backtrace.hpp"
+#include "../../include/outcome/telemetry.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+namespace telemetry_sampled_backtrace_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  namespace telemetry = OUTCOME_V2_NAMESPACE::telemetry;
+  namespace sampled_backtrace = OUTCOME_V2_NAMESPACE::sampled_backtrace;
+
+  extern QUICKCPPLIB_NOINLINE telemetry::result<int> fail(int x)
+  {
+    if(x > 0)
+    {
+      return x;
+    }
+    return std::errc::no_buffer_space;
+  }
+}  // namespace telemetry_sampled_backtrace_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / telemetry / sampled_backtrace, "Tests that telemetry and sampled backtraces both observe the same result")
+{
+  using namespace telemetry_sampled_backtrace_test;
+  static_assert(std::is_same<telemetry::result<int>, sampled_backtrace::result<int>>::value, "both features must share one result type");
+  static_assert(std::is_same<telemetry::outcome<int>, sampled_backtrace::outcome<int>>::value, "both features must share one outcome type");
+  const auto enobufs = std::make_error_code(std::errc::no_buffer_space);
+  const uint32_t oldrate = sampled_backtrace::sample_rate();
+  sampled_backtrace::set_sample_rate(1);
+  const uint64_t before = telemetry::take_snapshot().count(enobufs);
+
+  auto r0 = fail(1);
+  BOOST_CHECK(!sampled_backtrace::backtrace_of(r0));
+  auto r1 = fail(0);
+  sampled_backtrace::outcome<int> o1(std::make_error_code(std::errc::no_buffer_space));
+  BOOST_CHECK(telemetry::take_snapshot().count(enobufs) - before == 2);
+#ifndef OUTCOME_DISABLE_EXECINFO
+  BOOST_CHECK(sampled_backtrace::backtrace_of(r1));
+  BOOST_CHECK(sampled_backtrace::backtrace_of(o1));
+#endif
+
+  // A conversion is counted by neither, and keeps its source's backtrace
+  telemetry::outcome<int> o2(r1);
+  BOOST_CHECK(telemetry::take_snapshot().count(enobufs) - before == 2);
+  BOOST_CHECK(sampled_backtrace::backtrace_of(o2).frames() == sampled_backtrace::backtrace_of(r1).frames());
+  sampled_backtrace::set_sample_rate(oldrate);
+}
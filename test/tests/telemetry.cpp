@@ -0,0 +1,109 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/telemetry.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <sstream>
+#include <thread>
+
+namespace telemetry_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+  namespace telemetry = OUTCOME_V2_NAMESPACE::telemetry;
+
+  inline telemetry::result<int> fail(int x)
+  {
+    if(x > 0)
+    {
+      return x;
+    }
+    if(x == 0)
+    {
+      return std::errc::resource_unavailable_try_again;
+    }
+    return outcome::failure(std::make_error_code(std::errc::connection_reset));
+  }
+}  // namespace telemetry_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / telemetry / counts, "Tests that the telemetry module counts errored constructions per code across threads")
+{
+  using namespace telemetry_test;
+  const auto eagain = std::make_error_code(std::errc::resource_unavailable_try_again);
+  const auto econnreset = std::make_error_code(std::errc::connection_reset);
+  telemetry::collector c;
+  const auto &before = c.collect();
+  const uint64_t eagain_before = before.count(eagain), econnreset_before = before.count(econnreset), total_before = before.total();
+
+  // Successful constructions are never counted
+  for(int n = 1; n < 100; n++)
+  {
+    BOOST_CHECK(fail(n).has_value());
+  }
+  auto worker = [] {
+    for(int n = 0; n < 1000; n++)
+    {
+      (void) fail(0);
+      if(n % 10 == 0)
+      {
+        (void) fail(-1);
+      }
+    }
+  };
+  std::thread t1(worker), t2(worker);
+  worker();
+  t1.join();
+  t2.join();
+
+  const auto &after = c.collect();
+  BOOST_CHECK(after.count(eagain) - eagain_before == 3000);
+  BOOST_CHECK(after.count(econnreset) - econnreset_before == 300);
+  BOOST_CHECK(after.total() - total_before == 3300);
+  BOOST_REQUIRE(!after.top(1).empty());
+  BOOST_CHECK(after.top(1).front().code() == eagain);
+  BOOST_CHECK(after.top(1).front().rate > 0);
+
+  // Outcomes are counted, conversions from an already counted result are not
+  telemetry::outcome<int> o1(std::make_error_code(std::errc::connection_reset));
+  telemetry::outcome<int> o2(fail(-1));
+  (void) o1;
+  (void) o2;
+  BOOST_CHECK(c.collect().count(econnreset) - econnreset_before == 302);
+
+  std::stringstream s;
+  c.last().dump(s, 2);
+  BOOST_CHECK(s.str().find("count=") != std::string::npos);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / telemetry / recycle, "Tests that the counters of exited threads are kept and reused")
+{
+  using namespace telemetry_test;
+  const auto ebadf = std::make_error_code(std::errc::bad_file_descriptor);
+  const uint64_t before = telemetry::take_snapshot().count(ebadf);
+  for(int n = 0; n < 4; n++)
+  {
+    std::thread([] { telemetry::record(std::make_error_code(std::errc::bad_file_descriptor)); }).join();
+  }
+  BOOST_CHECK(telemetry::take_snapshot().count(ebadf) - before == 4);
+}
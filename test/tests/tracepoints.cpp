@@ -0,0 +1,77 @@
+/* Unit testing for outcomes
+(C) 2026 Outcome contributors
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#define OUTCOME_ENABLE_TRACEPOINTS 1
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace tracepoints_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  inline outcome::result<int> source(int x)
+  {
+    if(x > 0)
+    {
+      return x;
+    }
+    return std::errc::invalid_argument;
+  }
+  inline outcome::outcome<int> propagate(int x)
+  {
+    OUTCOME_TRY(v, source(x));
+    return v + 1;
+  }
+}  // namespace tracepoints_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / tracepoints, "Tests that enabling tracepoints changes no behaviour and emits SDT notes")
+{
+  using namespace tracepoints_test;
+  // Constant evaluation must still work
+  static constexpr outcome::result<int, std::errc> c(5);
+  static_assert(c.value() == 5, "");
+
+  BOOST_CHECK(propagate(1).value() == 2);
+  BOOST_CHECK(propagate(0).error() == std::errc::invalid_argument);
+#ifdef __cpp_exceptions
+  BOOST_CHECK_THROW(source(0).value(), std::system_error);
+#endif
+
+#if OUTCOME_HAVE_TRACEPOINTS && defined(__linux__)
+  // Each probe is described by an ELF note holding the provider and probe names
+  std::ifstream exe("/proc/self/exe", std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(exe)), std::istreambuf_iterator<char>());
+  BOOST_CHECK(contents.find("stapsdt") != std::string::npos);
+  for(const char *probe : {"result_construct", "outcome_construct", "try_return", "value_check_throw"})
+  {
+    BOOST_CHECK(contents.find(std::string("outcome") + '\0' + probe + '\0') != std::string::npos);
+  }
+#endif
+}